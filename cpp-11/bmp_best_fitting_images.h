@@ -342,8 +342,11 @@ namespace bmpl
         const bool force_bottom_up
     ) noexcept
     {
-        if (!bmpl::frmt::BAHeader::is_BA_file(filepath)) {
+        // notice: the file is opened once, and its source of bytes is then shared with the loaded image
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        if (in_stream.failed() || !bmpl::frmt::BAHeader::is_BA_file(in_stream)) {
             // only one image to be loaded, can't provide a better one.
+            in_stream.close();
             return MyImageBaseClass(filepath, apply_gamma_correction, skipped_mode, force_bottom_up);
         }
 
@@ -351,11 +354,6 @@ namespace bmpl
         if (target_dpi_y_resolution == 0)
             target_dpi_y_resolution = target_dpi_x_resolution;
 
-        bmpl::utils::LEInStream in_stream(filepath);
-        if (in_stream.failed()) {
-            // some error happenned while attempting to open the compressed image file
-            return MyImageBaseClass(in_stream.get_error());
-        }
 
         bmpl::frmt::BAHeadersList ba_headers_list{ bmpl::frmt::BAHeader::get_BA_headers(in_stream) };
         if (ba_headers_list.failed()) {
@@ -498,17 +496,15 @@ namespace bmpl
         const bool force_bottom_up
     ) noexcept
     {
-        if (!bmpl::frmt::BAHeader::is_BA_file(filepath)) {
+        // notice: the file is opened once, and its source of bytes is then shared with the loaded image
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        if (in_stream.failed() || !bmpl::frmt::BAHeader::is_BA_file(in_stream)) {
             // only one image to be loaded, can't provide a better one.
+            in_stream.close();
             return MyImageBaseClass(filepath, apply_gamma_correction, skipped_mode, force_bottom_up);
         }
 
         // ok, "BA" file
-        bmpl::utils::LEInStream in_stream(filepath);
-        if (in_stream.failed()) {
-            // some error happenned while attempting to open the compressed image file
-            return MyImageBaseClass(in_stream.get_error());
-        }
 
         bmpl::frmt::BAHeadersList ba_headers_list{ bmpl::frmt::BAHeader::get_BA_headers(in_stream) };
         if (ba_headers_list.failed()) {
@@ -617,8 +613,11 @@ namespace bmpl
         const bool force_bottom_up
     ) noexcept
     {
-        if (!bmpl::frmt::BAHeader::is_BA_file(filepath)) {
+        // notice: the file is opened once, and its source of bytes is then shared with the loaded image
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        if (in_stream.failed() || !bmpl::frmt::BAHeader::is_BA_file(in_stream)) {
             // only one image to be loaded, can't provide a better one.
+            in_stream.close();
             return MyImageBaseClass(filepath, apply_gamma_correction, skipped_mode, force_bottom_up);
         }
 
@@ -626,11 +625,6 @@ namespace bmpl
         if (target_dpi_y_resolution == 0)
             target_dpi_y_resolution = target_dpi_x_resolution;
 
-        bmpl::utils::LEInStream in_stream(filepath);
-        if (in_stream.failed()) {
-            // some error happenned while attempting to open the compressed image file
-            return MyImageBaseClass(in_stream.get_error());
-        }
 
         bmpl::frmt::BAHeadersList ba_headers_list{ bmpl::frmt::BAHeader::get_BA_headers(in_stream) };
         if (ba_headers_list.failed()) {
@@ -740,17 +734,15 @@ namespace bmpl
         const bool force_bottom_up
     ) noexcept
     {
-        if (!bmpl::frmt::BAHeader::is_BA_file(filepath)) {
+        // notice: the file is opened once, and its source of bytes is then shared with the loaded image
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        if (in_stream.failed() || !bmpl::frmt::BAHeader::is_BA_file(in_stream)) {
             // only one image to be loaded, can't provide a better one.
+            in_stream.close();
             return MyImageBaseClass(filepath, apply_gamma_correction, skipped_mode, force_bottom_up);
         }
 
         // ok, "BA" file
-        bmpl::utils::LEInStream in_stream(filepath);
-        if (in_stream.failed()) {
-            // some error happenned while attempting to open the compressed image file
-            return MyImageBaseClass(in_stream.get_error());
-        }
 
         bmpl::frmt::BAHeadersList ba_headers_list{ bmpl::frmt::BAHeader::get_BA_headers(in_stream) };
         if (ba_headers_list.failed()) {
@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define BMPL_X86_BMI2
+#endif
+
+#include "bitfields_decoders.h"
+
+
+#if defined(BMPL_X86_BMI2) && (defined(__GNUC__) || defined(__clang__))
+#define BMPL_TARGET_BMI2 __attribute__((target("bmi2")))
+#else
+#define BMPL_TARGET_BMI2
+#endif
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        //  Local kernel - BitfieldsLineDecoder<> selects it only when the running CPU provides BMI2
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        BMPL_TARGET_BMI2
+        static void _decode_bitfields_line_pext(PixelT* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept
+        {
+#if defined(BMPL_X86_BMI2)
+            const BitfieldComponent red{ components[0] }, green{ components[1] }, blue{ components[2] }, alpha{ components[3] };
+            for (std::size_t x = 0; x < width; ++x, line_ptr += bytes_per_pixel) {
+                const std::uint32_t pixel_value{ (bytes_per_pixel == sizeof(std::uint16_t)) ? std::uint32_t(bmpl::utils::get_le_uint16(line_ptr)) : bmpl::utils::get_le_uint32(line_ptr) };
+                bmpl::clr::set_pixel(
+                    *pixels_ptr++,
+                    red.scale(_pext_u32(pixel_value, red.mask)),
+                    green.scale(_pext_u32(pixel_value, green.mask)),
+                    blue.scale(_pext_u32(pixel_value, blue.mask)),
+                    alpha.scale(_pext_u32(pixel_value, alpha.mask))
+                );
+            }
+#endif
+        }
+
+
+        //===========================================================================
+        //  decode_bitfields_line_pext()
+        //---------------------------------------------------------------------------
+        void decode_bitfields_line_pext(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept
+        {
+            _decode_bitfields_line_pext(pixels_ptr, line_ptr, width, bytes_per_pixel, components);
+        }
+
+        //---------------------------------------------------------------------------
+        void decode_bitfields_line_pext(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept
+        {
+            _decode_bitfields_line_pext(pixels_ptr, line_ptr, width, bytes_per_pixel, components);
+        }
+
+        //---------------------------------------------------------------------------
+        void decode_bitfields_line_pext(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept
+        {
+            _decode_bitfields_line_pext(pixels_ptr, line_ptr, width, bytes_per_pixel, components);
+        }
+
+        //---------------------------------------------------------------------------
+        void decode_bitfields_line_pext(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept
+        {
+            _decode_bitfields_line_pext(pixels_ptr, line_ptr, width, bytes_per_pixel, components);
+        }
+
+    }
+}
\ No newline at end of file
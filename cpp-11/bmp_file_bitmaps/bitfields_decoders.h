@@ -0,0 +1,375 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "../utils/colors.h"
+#include "../utils/cpu_features.h"
+#include "../utils/little_endian_streaming.h"
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        // Compile-time evaluations of bitfield masks
+        inline constexpr std::uint32_t get_mask_shift(const std::uint32_t mask) noexcept
+        {
+            std::uint32_t shift{ 0 };
+            if (mask != 0)
+                for (std::uint32_t m = mask; (m & 1) == 0; m >>= 1)
+                    ++shift;
+            return shift;
+        }
+
+        inline constexpr std::uint32_t get_mask_bits_count(const std::uint32_t mask) noexcept
+        {
+            std::uint32_t bits_count{ 0 };
+            for (std::uint32_t m = mask; m != 0; m >>= 1)
+                bits_count += m & 1;
+            return bits_count;
+        }
+
+        inline constexpr bool is_contiguous_mask(const std::uint32_t mask) noexcept
+        {
+            // notice: once shifted, contiguous set bits are all ones and adding 1 to them carries out of all of them
+            return mask == 0 || (((mask >> get_mask_shift(mask)) + 1) & (mask >> get_mask_shift(mask))) == 0;
+        }
+
+
+        //===========================================================================
+        // Rescales n-bits color components to 8 bits with one multiplication and one shift,
+        // the same way as BitfieldMaskBase::get_component_value() does with bits replication
+        inline constexpr std::uint32_t get_scale_multiplier(const std::uint32_t bits_count) noexcept
+        {
+            return (bits_count == 0) ? 0 :
+                   (bits_count == 1) ? 0b1111'1111 :
+                   (bits_count == 2) ? 0b0101'0101 :
+                   (bits_count == 3) ? 0b0100'1001 :
+                   (bits_count == 4) ? 0b0001'0001 :
+                   (bits_count == 5) ? 0b0010'0001 :
+                   (bits_count == 6) ? 0b0100'0001 :
+                   (bits_count == 7) ? 0b1000'0001 : 1;
+        }
+
+        inline constexpr std::uint32_t get_scale_shift(const std::uint32_t bits_count) noexcept
+        {
+            return (bits_count == 3) ? 1 :
+                   (bits_count == 5) ? 2 :
+                   (bits_count == 6) ? 4 :
+                   (bits_count == 7) ? 6 :
+                   (bits_count > 8) ? bits_count - 8 : 0;
+        }
+
+
+        //===========================================================================
+        // The per-image description of one color component in bitfields
+        struct BitfieldComponent
+        {
+            std::uint32_t mask{ 0 };
+            std::uint32_t shift{ 0 };
+            std::uint32_t scale_multiplier{ 0 };
+            std::uint32_t scale_shift{ 0 };
+
+            inline BitfieldComponent() noexcept = default;
+
+            inline BitfieldComponent(const std::uint32_t mask_) noexcept
+                : mask(mask_)
+                , shift(get_mask_shift(mask_))
+                , scale_multiplier(get_scale_multiplier(get_mask_bits_count(mask_)))
+                , scale_shift(get_scale_shift(get_mask_bits_count(mask_)))
+            {}
+
+            inline const std::uint32_t scale(const std::uint32_t component) const noexcept
+            {
+                return (component * scale_multiplier) >> scale_shift;
+            }
+        };
+
+        using BitfieldsComponents = std::array<BitfieldComponent, 4>;  // notice: red, green, blue then alpha components
+
+
+        //===========================================================================
+        // Decodes a line of 16-bits or 32-bits pixels with non-contiguous bitfield masks, with BMI2 'pext' instructions
+        void decode_bitfields_line_pext(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept;
+        void decode_bitfields_line_pext(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept;
+        void decode_bitfields_line_pext(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept;
+        void decode_bitfields_line_pext(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::size_t bytes_per_pixel, const BitfieldsComponents& components) noexcept;
+
+
+        //===========================================================================
+        // Decodes lines of 16-bits and 32-bits bitfields pixels with a decoding function selected once per image:
+        // statically specialized ones for the most common masks sets, generic ones for any other masks
+        template<typename PixelT>
+        class BitfieldsLineDecoder
+        {
+        public:
+            void select(
+                const std::uint32_t red_mask,
+                const std::uint32_t green_mask,
+                const std::uint32_t blue_mask,
+                const std::uint32_t alpha_mask,
+                const std::size_t bytes_per_pixel
+            ) noexcept;
+
+
+            inline void decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width) const noexcept
+            {
+                this->_decode_line_func(line_ptr, pixels_ptr, width, this->_components);
+            }
+
+
+        private:
+            using DecodeLineFunc = void(*)(const std::uint8_t*, PixelT*, const std::size_t, const BitfieldsComponents&);
+
+            BitfieldsComponents _components{};
+            DecodeLineFunc _decode_line_func{ _decode_line_none };
+
+
+            template<typename ValueT>
+            static inline const std::uint32_t _get_pixel_value(const std::uint8_t* pixel_ptr) noexcept
+            {
+                return (sizeof(ValueT) == sizeof(std::uint16_t)) ? std::uint32_t(bmpl::utils::get_le_uint16(pixel_ptr)) : bmpl::utils::get_le_uint32(pixel_ptr);
+            }
+
+            template<const std::uint32_t MASK>
+            static inline const std::uint32_t _get_static_component(const std::uint32_t pixel_value) noexcept
+            {
+                // notice: masks, shifts and scaling get all evaluated at compile time
+                return (((pixel_value & MASK) >> get_mask_shift(MASK)) * get_scale_multiplier(get_mask_bits_count(MASK))) >> get_scale_shift(get_mask_bits_count(MASK));
+            }
+
+            template<typename ValueT, const std::uint32_t RED_MASK, const std::uint32_t GREEN_MASK, const std::uint32_t BLUE_MASK, const std::uint32_t ALPHA_MASK>
+            static void _decode_line_static(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width, const BitfieldsComponents&) noexcept
+            {
+                for (std::size_t x = 0; x < width; ++x, line_ptr += sizeof(ValueT)) {
+                    const std::uint32_t pixel_value{ _get_pixel_value<ValueT>(line_ptr) };
+                    bmpl::clr::set_pixel(
+                        *pixels_ptr++,
+                        _get_static_component<RED_MASK>(pixel_value),
+                        _get_static_component<GREEN_MASK>(pixel_value),
+                        _get_static_component<BLUE_MASK>(pixel_value),
+                        _get_static_component<ALPHA_MASK>(pixel_value)
+                    );
+                }
+            }
+
+            template<typename ValueT>
+            static void _decode_line_contiguous(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width, const BitfieldsComponents& components) noexcept
+            {
+                const BitfieldComponent red{ components[0] }, green{ components[1] }, blue{ components[2] }, alpha{ components[3] };
+                for (std::size_t x = 0; x < width; ++x, line_ptr += sizeof(ValueT)) {
+                    const std::uint32_t pixel_value{ _get_pixel_value<ValueT>(line_ptr) };
+                    bmpl::clr::set_pixel(
+                        *pixels_ptr++,
+                        red.scale((pixel_value & red.mask) >> red.shift),
+                        green.scale((pixel_value & green.mask) >> green.shift),
+                        blue.scale((pixel_value & blue.mask) >> blue.shift),
+                        alpha.scale((pixel_value & alpha.mask) >> alpha.shift)
+                    );
+                }
+            }
+
+            template<typename ValueT>
+            static void _decode_line_pext(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width, const BitfieldsComponents& components) noexcept
+            {
+                bmpl::bmpf::decode_bitfields_line_pext(pixels_ptr, line_ptr, width, sizeof(ValueT), components);
+            }
+
+            template<typename ValueT>
+            static void _decode_line_scattered(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width, const BitfieldsComponents& components) noexcept
+            {
+                // notice: portable gathering of the set bits of non-contiguous masks, used when BMI2 is not available
+                std::uint32_t rgba[4];
+                for (std::size_t x = 0; x < width; ++x, line_ptr += sizeof(ValueT)) {
+                    const std::uint32_t pixel_value{ _get_pixel_value<ValueT>(line_ptr) };
+                    for (int c = 0; c < 4; ++c) {
+                        std::uint32_t component{ 0 };
+                        std::uint32_t component_bit{ 1 };
+                        for (std::uint32_t mask = components[c].mask; mask != 0; mask &= mask - 1, component_bit <<= 1) {
+                            if (pixel_value & mask & (~mask + 1))  // i.e. the lowest set bit of the remaining mask
+                                component |= component_bit;
+                        }
+                        rgba[c] = components[c].scale(component);
+                    }
+                    bmpl::clr::set_pixel(*pixels_ptr++, rgba[0], rgba[1], rgba[2], rgba[3]);
+                }
+            }
+
+            static void _decode_line_none(const std::uint8_t*, PixelT*, const std::size_t, const BitfieldsComponents&) noexcept
+            {}
+
+            template<typename ValueT>
+            void _select(const std::uint32_t red_mask, const std::uint32_t green_mask, const std::uint32_t blue_mask, const std::uint32_t alpha_mask) noexcept;
+
+        };
+
+
+        //===========================================================================
+        template<typename PixelT>
+        void BitfieldsLineDecoder<PixelT>::select(
+            const std::uint32_t red_mask,
+            const std::uint32_t green_mask,
+            const std::uint32_t blue_mask,
+            const std::uint32_t alpha_mask,
+            const std::size_t bytes_per_pixel
+        ) noexcept
+        {
+            this->_components = { BitfieldComponent(red_mask), BitfieldComponent(green_mask), BitfieldComponent(blue_mask), BitfieldComponent(alpha_mask) };
+
+            if (bytes_per_pixel == sizeof(std::uint16_t))
+                this->_select<std::uint16_t>(red_mask, green_mask, blue_mask, alpha_mask);
+            else
+                this->_select<std::uint32_t>(red_mask, green_mask, blue_mask, alpha_mask);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        template<typename ValueT>
+        void BitfieldsLineDecoder<PixelT>::_select(
+            const std::uint32_t red_mask,
+            const std::uint32_t green_mask,
+            const std::uint32_t blue_mask,
+            const std::uint32_t alpha_mask
+        ) noexcept
+        {
+            // notice: 16-bits masks are checked for 16-bits pixels only, 32-bits ones for 32-bits pixels only
+            if (sizeof(ValueT) == sizeof(std::uint16_t)) {
+                if (red_mask == 0xf800 && green_mask == 0x07e0 && blue_mask == 0x001f && alpha_mask == 0) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0xf800, 0x07e0, 0x001f, 0>;  // i.e. 565
+                    return;
+                }
+                if (red_mask == 0x7c00 && green_mask == 0x03e0 && blue_mask == 0x001f && alpha_mask == 0) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0x7c00, 0x03e0, 0x001f, 0>;  // i.e. 555
+                    return;
+                }
+                if (red_mask == 0x7c00 && green_mask == 0x03e0 && blue_mask == 0x001f && alpha_mask == 0x8000) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0x7c00, 0x03e0, 0x001f, 0x8000>;  // i.e. 1555
+                    return;
+                }
+            }
+            else {
+                if (red_mask == 0x00ff'0000 && green_mask == 0x0000'ff00 && blue_mask == 0x0000'00ff && alpha_mask == 0) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0x00ff'0000, 0x0000'ff00, 0x0000'00ff, 0>;  // i.e. 888
+                    return;
+                }
+                if (red_mask == 0x00ff'0000 && green_mask == 0x0000'ff00 && blue_mask == 0x0000'00ff && alpha_mask == 0xff00'0000) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0x00ff'0000, 0x0000'ff00, 0x0000'00ff, 0xff00'0000>;  // i.e. 8888
+                    return;
+                }
+                if (red_mask == 0x3ff0'0000 && green_mask == 0x000f'fc00 && blue_mask == 0x0000'03ff && alpha_mask == 0xc000'0000) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0x3ff0'0000, 0x000f'fc00, 0x0000'03ff, 0xc000'0000>;  // i.e. 2101010
+                    return;
+                }
+                if (red_mask == 0xffc0'0000 && green_mask == 0x003f'f000 && blue_mask == 0x0000'0ffc && alpha_mask == 0x0000'0003) {
+                    this->_decode_line_func = _decode_line_static<ValueT, 0xffc0'0000, 0x003f'f000, 0x0000'0ffc, 0x0000'0003>;  // i.e. 1010102
+                    return;
+                }
+            }
+
+            if (is_contiguous_mask(red_mask) && is_contiguous_mask(green_mask) && is_contiguous_mask(blue_mask) && is_contiguous_mask(alpha_mask))
+                this->_decode_line_func = _decode_line_contiguous<ValueT>;
+            else if (bmpl::utils::get_cpu_features().bmi2)
+                this->_decode_line_func = _decode_line_pext<ValueT>;
+            else
+                this->_decode_line_func = _decode_line_scattered<ValueT>;
+        }
+
+
+
+        //===========================================================================
+        // The final pixels of all the 65536 possible 16-bits bitfields values, for one set of masks.
+        // Tables are cached per masks set, so that images sharing the same masks share the same table.
+        template<typename PixelT>
+        using Bitfields16Table = std::vector<PixelT>;
+
+
+        template<typename PixelT>
+        std::shared_ptr<const Bitfields16Table<PixelT>> get_bitfields16_table(
+            const std::uint32_t red_mask,
+            const std::uint32_t green_mask,
+            const std::uint32_t blue_mask,
+            const std::uint32_t alpha_mask
+        ) noexcept
+        {
+            using MasksKey = std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>;
+            static constexpr std::size_t MAX_CACHED_TABLES{ 8 };  // notice: i.e. up to 2 MB for 32-bits pixels
+
+            static std::mutex cache_mutex;
+            static std::map<MasksKey, std::shared_ptr<const Bitfields16Table<PixelT>>> tables_cache;
+
+            const MasksKey masks_key{ red_mask, green_mask, blue_mask, alpha_mask };
+
+            try {
+                std::lock_guard<std::mutex> lock(cache_mutex);
+
+                auto cached_it = tables_cache.find(masks_key);
+                if (cached_it != tables_cache.end())
+                    return cached_it->second;
+
+                // the table gets evaluated by the decoding of a line made of all the possible 16-bits values
+                std::vector<std::uint8_t> values(2 * 65536);
+                for (std::uint32_t value = 0; value < 65536; ++value) {
+                    values[2 * value] = std::uint8_t(value);
+                    values[2 * value + 1] = std::uint8_t(value >> 8);
+                }
+
+                BitfieldsLineDecoder<PixelT> decoder;
+                decoder.select(red_mask, green_mask, blue_mask, alpha_mask, sizeof(std::uint16_t));
+
+                std::shared_ptr<Bitfields16Table<PixelT>> table_ptr{ std::make_shared<Bitfields16Table<PixelT>>(65536) };
+                decoder.decode_line(values.data(), table_ptr->data(), 65536);
+
+                if (tables_cache.size() >= MAX_CACHED_TABLES)
+                    tables_cache.erase(tables_cache.begin());  // notice: images in use keep their own reference to evicted tables
+                tables_cache[masks_key] = table_ptr;
+
+                return table_ptr;
+            }
+            catch (...) {
+                return nullptr;
+            }
+        }
+
+    }
+}
\ No newline at end of file
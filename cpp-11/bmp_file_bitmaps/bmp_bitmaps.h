@@ -32,15 +32,25 @@ SOFTWARE.
 */
 
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
-#include "bitfield_mask.h"
+#include "bitfields_decoders.h"
+#include "huffman_1d_tables.h"
+#include "lines_conversions.h"
 #include "../bmp_file_format/bmp_colormap.h"
 #include "../bmp_file_format/bmp_info_header.h"
 #include "../bmp_file_format/bmp_file_header.h"
 #include "../utils/errors.h"
 #include "../utils/little_endian_streaming.h"
+#include "../utils/memory_resources.h"
 #include "../utils/warnings.h"
 
 
@@ -56,83 +66,1078 @@ namespace bmpl
         }
 
 
+        //===========================================================================
+        // Buffers of bitmap bytes - their memory is got from the memory resource of their bitmap loader.
+        using BytesBuffer = bmpl::utils::ResourceVector<std::uint8_t>;
+
+
+        //===========================================================================
+        // Rows streaming callback - gets the index of the row in bitmap, a pointer to its pixels and its width.
+        // Returning false cancels the streaming of the remaining rows.
+        template<typename PixelT>
+        using DecodedRowCallback = std::function<const bool(const std::uint32_t row_index, PixelT* row_ptr, const std::uint32_t row_width)>;
+
+
+        //===========================================================================
+        // Fills pixels with the alternating pair of pixels (pxl_0, pxl_1), starting with pxl_0
+        template<typename PixelT>
+        inline void fill_pixels_pairs(PixelT* pixels_ptr, const std::size_t count, const PixelT& pxl_0, const PixelT& pxl_1) noexcept
+        {
+            PixelT* const pairs_end{ pixels_ptr + (count & ~std::size_t(1)) };
+            for (; pixels_ptr != pairs_end; pixels_ptr += 2) {
+                pixels_ptr[0] = pxl_0;
+                pixels_ptr[1] = pxl_1;
+            }
+            if (count & 1)
+                *pixels_ptr = pxl_0;
+        }
+
+
+        //===========================================================================
+        // Rows of the final image that bitmaps get decoded into - rows are addressed from the one of the
+        // first line of bitmap with a signed stride in bytes, so that bottom-up bitmaps get their lines
+        // decoded straight into their final rows
+        template<typename PixelT>
+        struct ImageRows
+        {
+            std::uint8_t* first_row_ptr{ nullptr };
+            std::ptrdiff_t row_stride{ 0 };
+
+            inline ImageRows(
+                PixelT* pixels_ptr,
+                const std::size_t row_stride_bytes,
+                const std::size_t height,
+                const bool reversed_rows
+            ) noexcept
+                : first_row_ptr(reinterpret_cast<std::uint8_t*>(pixels_ptr) + (reversed_rows && height > 0 ? (height - 1) * row_stride_bytes : 0))
+                , row_stride(reversed_rows ? -std::ptrdiff_t(row_stride_bytes) : std::ptrdiff_t(row_stride_bytes))
+            {}
+
+            inline PixelT* get_row(const std::size_t line) const noexcept
+            {
+                return reinterpret_cast<PixelT*>(first_row_ptr + std::ptrdiff_t(line) * row_stride);
+            }
+        };
+
+
+        //===========================================================================
+        // Rectangular region of bitmaps - y is the index of its first line in bitmap, x the index of its first pixel in lines
+        struct ImageRegion
+        {
+            std::size_t x{ 0 };
+            std::size_t y{ 0 };
+            std::size_t width{ 0 };
+            std::size_t height{ 0 };
+        };
+
+
+        //===========================================================================
+        // Output of RLE decoders into the whole image content - the image content is not initialized
+        // before decoding, so pixels that get skipped by RLE bitmaps are set to their default value
+        // while decoding, once each
+        template<typename PixelT>
+        class ImageContentOutput
+        {
+        public:
+            inline ImageContentOutput(
+                const ImageRows<PixelT>& image_rows,
+                const PixelT& default_pixel,
+                const std::size_t width,
+                const std::size_t height
+            ) noexcept
+                : _image_rows(image_rows)
+                , _default_pixel(default_pixel)
+                , _width(width)
+                , _size(width * height)
+            {
+                if (_size > 0)
+                    _select_row();
+            }
+
+            inline void flush() noexcept
+            {
+                // sets the default value to all the pixels which have been skipped up to the end of the image
+                move_to(_size);
+            }
+
+            inline const std::size_t get_index() const noexcept
+            {
+                return _index;
+            }
+
+            inline const bool can_write(const std::size_t count) const noexcept
+            {
+                return _index + count <= _size;
+            }
+
+            void fill(std::size_t count, const PixelT& pxl_value) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    std::fill_n(_row_ptr + (_index - _row_begin), n, pxl_value);
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            void fill_pairs(std::size_t count, const PixelT& pxl_0, const PixelT& pxl_1) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                bool swapped{ false };
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    fill_pixels_pairs(_row_ptr + (_index - _row_begin), n, swapped ? pxl_1 : pxl_0, swapped ? pxl_0 : pxl_1);
+                    swapped ^= (n & 1) != 0;
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            inline const bool is_done() const noexcept
+            {
+                // notice: the whole image gets decoded
+                return false;
+            }
+
+            inline const bool is_full() const noexcept
+            {
+                return _index >= _size;
+            }
+
+            inline const bool move_to(const std::size_t index) noexcept
+            {
+                // notice: pixels are written sequentially from indices that are never beyond the already set ones,
+                // so the skipped pixels are exactly the ones between the already set pixels and the new index
+                if (_index > _set_end)
+                    _set_end = _index;
+                if (index > _set_end && _set_end < _size) {
+                    _index = _set_end;
+                    fill(std::min(index, _size) - _set_end, _default_pixel);
+                    _set_end = _index;
+                }
+                _index = index;
+                return true;
+            }
+
+            inline PixelT& next() noexcept
+            {
+                if (_index - _row_begin >= _width)
+                    _select_row();
+                return _row_ptr[_index++ - _row_begin];
+            }
+
+
+        private:
+            ImageRows<PixelT> _image_rows;
+            PixelT* _row_ptr{ nullptr };
+            PixelT _default_pixel{};
+            std::size_t _width{ 0 };
+            std::size_t _size{ 0 };
+            std::size_t _index{ 0 };
+            std::size_t _row_begin{ 0 };
+            std::size_t _set_end{ 0 };  // notice: all the pixels before this index have been either decoded or set to their default value
+
+            inline void _select_row() noexcept
+            {
+                // notice: indices may move backward as well as forward, with delta records and lines overflows
+                const std::size_t line{ _index / _width };
+                _row_begin = line * _width;
+                _row_ptr = _image_rows.get_row(line);
+            }
+
+            inline const std::size_t _next_segment(const std::size_t count) noexcept
+            {
+                // gets the count of pixels that can be written in the current row
+                if (_index - _row_begin >= _width)
+                    _select_row();
+                return std::min(count, _row_begin + _width - _index);
+            }
+
+        };
+
+
+        //===========================================================================
+        // Output of RLE decoders row after row - only the current row is kept in memory,
+        // completed rows are delivered to the row callback as soon as decoding moves past them
+        template<typename PixelT>
+        class RowsOutput
+        {
+        public:
+            RowsOutput(
+                const DecodedRowCallback<PixelT>& row_callback,
+                const PixelT& default_pixel,
+                const std::size_t width,
+                const std::size_t height,
+                bmpl::utils::MemoryResource* resource_ptr = nullptr
+            ) noexcept
+                : _row_callback(row_callback)
+                , _row(bmpl::utils::ResourceAllocator<PixelT>(resource_ptr))
+                , _default_pixel(default_pixel)
+                , _width(width)
+                , _height(height)
+                , _size(width * height)
+                , _row_end(width)
+            {
+                try {
+                    _row.assign(width, default_pixel);
+                }
+                catch (...) {
+                    _height = _size = 0;
+                }
+            }
+
+            inline const bool flush() noexcept
+            {
+                // delivers the current row and all the remaining ones
+                _emit_rows(_height);
+                return !_cancelled;
+            }
+
+            inline const std::size_t get_index() const noexcept
+            {
+                return _index;
+            }
+
+            inline const bool can_write(const std::size_t count) const noexcept
+            {
+                return _index + count <= _size && !_cancelled;
+            }
+
+            void fill(std::size_t count, const PixelT& pxl_value) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    std::fill_n(_row.data() + (_index - _row_begin), n, pxl_value);
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            void fill_pairs(std::size_t count, const PixelT& pxl_0, const PixelT& pxl_1) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                bool swapped{ false };
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    fill_pixels_pairs(_row.data() + (_index - _row_begin), n, swapped ? pxl_1 : pxl_0, swapped ? pxl_0 : pxl_1);
+                    swapped ^= (n & 1) != 0;
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            inline const bool is_cancelled() const noexcept
+            {
+                return _cancelled;
+            }
+
+            inline const bool is_done() const noexcept
+            {
+                // notice: all the rows get streamed
+                return false;
+            }
+
+            inline const bool is_full() const noexcept
+            {
+                return _index >= _size || _cancelled;
+            }
+
+            inline const bool move_to(const std::size_t index) noexcept
+            {
+                // notice: rows that have already been delivered cannot be modified any more
+                if (index < _row_begin)
+                    return false;
+                _index = index;
+                return true;
+            }
+
+            inline PixelT& next() noexcept
+            {
+                if (_index >= _row_end)
+                    _emit_rows(_index / _width);
+                return _row[_index++ - _row_begin];
+            }
+
+
+        private:
+            const DecodedRowCallback<PixelT>& _row_callback;
+            bmpl::utils::ResourceVector<PixelT> _row;
+            PixelT _default_pixel{};
+            std::size_t _width{ 0 };
+            std::size_t _height{ 0 };
+            std::size_t _size{ 0 };
+            std::size_t _index{ 0 };
+            std::size_t _row_index{ 0 };
+            std::size_t _row_begin{ 0 };
+            std::size_t _row_end{ 0 };
+            bool _cancelled{ false };
+
+            void _emit_rows(const std::size_t new_row_index) noexcept
+            {
+                // delivers the current row, then the skipped ones, up to the new current row
+                for (; _row_index < new_row_index && _row_index < _height; ++_row_index) {
+                    if (!_cancelled && !_row_callback(std::uint32_t(_row_index), _row.data(), std::uint32_t(_width)))
+                        _cancelled = true;
+                    std::fill(_row.begin(), _row.end(), _default_pixel);
+                }
+                _row_begin = _row_index * _width;
+                _row_end = _row_begin + _width;
+            }
+
+            inline const std::size_t _next_segment(const std::size_t count) noexcept
+            {
+                // gets the count of pixels that can be written in the current row
+                if (_index >= _row_end)
+                    _emit_rows(_index / _width);
+                return std::min(count, _row_end - _index);
+            }
+
+        };
+
+
+        //===========================================================================
+        // Output of RLE decoders into a region of the image - only the pixels of the region get written,
+        // its skipped pixels are set to their default value, and decoding is done as soon as it has moved
+        // past the last line of the region
+        template<typename PixelT>
+        class RegionOutput
+        {
+        public:
+            inline RegionOutput(
+                const ImageRows<PixelT>& region_rows,
+                const ImageRegion& region,
+                const PixelT& default_pixel,
+                const std::size_t width,
+                const std::size_t height
+            ) noexcept
+                : _region_rows(region_rows)
+                , _region(region)
+                , _default_pixel(default_pixel)
+                , _width(width)
+                , _size(width * height)
+                , _begin(std::min(region.y * width, width * height))
+                , _end(std::min((region.y + region.height) * width, width * height))
+            {
+                if (_size > 0)
+                    _select_row();
+            }
+
+            inline void flush() noexcept
+            {
+                // sets the default value to all the pixels of the region which have been skipped
+                move_to(_end);
+            }
+
+            inline const std::size_t get_index() const noexcept
+            {
+                return _index;
+            }
+
+            inline const bool can_write(const std::size_t count) const noexcept
+            {
+                return _index + count <= _size;
+            }
+
+            void fill(std::size_t count, const PixelT& pxl_value) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    std::size_t column, clipped_count;
+                    if (_clip(n, column, clipped_count))
+                        std::fill_n(_row_ptr + column, clipped_count, pxl_value);
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            void fill_pairs(std::size_t count, const PixelT& pxl_0, const PixelT& pxl_1) noexcept
+            {
+                // notice: count has been validated with can_write() before; runs may overflow rows
+                bool swapped{ false };
+                while (count > 0) {
+                    const std::size_t n{ _next_segment(count) };
+                    std::size_t column, clipped_count;
+                    if (_clip(n, column, clipped_count)) {
+                        // notice: runs clipped on their left side may start with their second pixel value
+                        const bool odd_start{ swapped != (((_region.x + column - (_index - _row_begin)) & 1) != 0) };
+                        fill_pixels_pairs(_row_ptr + column, clipped_count, odd_start ? pxl_1 : pxl_0, odd_start ? pxl_0 : pxl_1);
+                    }
+                    swapped ^= (n & 1) != 0;
+                    _index += n;
+                    count -= n;
+                }
+            }
+
+            inline const bool is_done() const noexcept
+            {
+                return _index >= _end;
+            }
+
+            inline const bool is_full() const noexcept
+            {
+                return _index >= _size;
+            }
+
+            inline const bool move_to(const std::size_t index) noexcept
+            {
+                // notice: as with the whole image content, the skipped pixels are exactly the ones between the already set pixels and the new index
+                if (_index > _set_end)
+                    _set_end = _index;
+                if (index > _set_end) {
+                    const std::size_t skipped_begin{ std::max(_set_end, _begin) };
+                    const std::size_t skipped_end{ std::min(index, _end) };
+                    if (skipped_begin < skipped_end) {
+                        _index = skipped_begin;
+                        fill(skipped_end - skipped_begin, _default_pixel);
+                    }
+                    _set_end = index;
+                }
+                _index = index;
+                return true;
+            }
+
+            inline PixelT& next() noexcept
+            {
+                if (_index - _row_begin >= _width)
+                    _select_row();
+                // notice: pixels out of the region get written into a sink
+                const std::size_t column{ _index++ - _row_begin - _region.x };
+                return (_row_ptr != nullptr && column < _region.width) ? _row_ptr[column] : _sink;
+            }
+
+
+        private:
+            ImageRows<PixelT> _region_rows;
+            ImageRegion _region{};
+            PixelT* _row_ptr{ nullptr };  // notice: nullptr for the rows that are out of the region
+            PixelT _default_pixel{};
+            PixelT _sink{};
+            std::size_t _width{ 0 };
+            std::size_t _size{ 0 };
+            std::size_t _begin{ 0 };
+            std::size_t _end{ 0 };
+            std::size_t _index{ 0 };
+            std::size_t _row_begin{ 0 };
+            std::size_t _set_end{ 0 };
+
+            inline void _select_row() noexcept
+            {
+                const std::size_t line{ _index / _width };
+                _row_begin = line * _width;
+                _row_ptr = (line >= _region.y && line - _region.y < _region.height) ? _region_rows.get_row(line - _region.y) : nullptr;
+            }
+
+            inline const std::size_t _next_segment(const std::size_t count) noexcept
+            {
+                // gets the count of pixels that can be written in the current row
+                if (_index - _row_begin >= _width)
+                    _select_row();
+                return std::min(count, _row_begin + _width - _index);
+            }
+
+            inline const bool _clip(const std::size_t count, std::size_t& column, std::size_t& clipped_count) const noexcept
+            {
+                // clips the next count pixels of the current row to the region, with column relative to the region
+                if (_row_ptr == nullptr)
+                    return false;
+                const std::size_t first{ std::max(_index - _row_begin, _region.x) };
+                const std::size_t last{ std::min(_index - _row_begin + count, _region.x + _region.width) };
+                if (first >= last)
+                    return false;
+                column = first - _region.x;
+                clipped_count = last - first;
+                return true;
+            }
+
+        };
+
+
+        //===========================================================================
+        // Expands each byte of packed palette indices into its 8, 4 or 2 final pixels at once
+        template<typename PixelT, const std::uint32_t BITS_PER_PIXEL>
+        class PackedIndicesTable
+        {
+        public:
+            static constexpr std::size_t PIXELS_PER_BYTE{ 8 / BITS_PER_PIXEL };
+            static constexpr std::uint32_t INDEX_MASK{ (1 << BITS_PER_PIXEL) - 1 };
+
+
+            void build(const bmpl::frmt::BMPColorMap& color_map) noexcept
+            {
+                _colors_count = color_map.colors_count;
+                _bad_indices_met = false;
+
+                for (std::uint32_t byte = 0; byte < 256; ++byte) {
+                    bool bad_byte{ false };
+                    for (std::size_t k = 0; k < PIXELS_PER_BYTE; ++k) {
+                        const std::uint32_t index{ _get_index(std::uint8_t(byte), k) };
+                        // notice: bad indices get entry 0 as their default color, as with the color map
+                        bmpl::clr::convert(_pixels[byte * PIXELS_PER_BYTE + k], color_map.data()[(index < _colors_count) ? index : 0]);
+                        bad_byte |= index >= _colors_count;
+                    }
+                    _bad_bytes[byte] = bad_byte;
+                }
+            }
+
+
+            void expand_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width) noexcept
+            {
+                bool bad_indices{ false };
+
+                const std::uint8_t* line_end{ line_ptr + width / PIXELS_PER_BYTE };
+                for (; line_ptr < line_end; ++line_ptr, pixels_ptr += PIXELS_PER_BYTE) {
+                    const PixelT* entry_ptr{ _pixels.data() + *line_ptr * PIXELS_PER_BYTE };
+                    for (std::size_t k = 0; k < PIXELS_PER_BYTE; ++k)
+                        pixels_ptr[k] = entry_ptr[k];
+                    bad_indices |= _bad_bytes[*line_ptr];
+                }
+
+                // the last pixels of lines that do not fill their last byte
+                const std::size_t remaining_count{ width % PIXELS_PER_BYTE };
+                if (remaining_count > 0) {
+                    const PixelT* entry_ptr{ _pixels.data() + *line_ptr * PIXELS_PER_BYTE };
+                    for (std::size_t k = 0; k < remaining_count; ++k) {
+                        pixels_ptr[k] = entry_ptr[k];
+                        bad_indices |= _get_index(*line_ptr, k) >= _colors_count;
+                    }
+                }
+
+                _bad_indices_met |= bad_indices;
+            }
+
+
+            void expand_span(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, std::size_t count) noexcept
+            {
+                line_ptr += first_x / PIXELS_PER_BYTE;
+
+                // the first pixels of spans that do not start on a byte boundary
+                std::size_t rank{ first_x % PIXELS_PER_BYTE };
+                if (rank > 0) {
+                    const PixelT* entry_ptr{ _pixels.data() + *line_ptr * PIXELS_PER_BYTE };
+                    for (; rank < PIXELS_PER_BYTE && count > 0; ++rank, --count) {
+                        *pixels_ptr++ = entry_ptr[rank];
+                        _bad_indices_met |= _get_index(*line_ptr, rank) >= _colors_count;
+                    }
+                    ++line_ptr;
+                }
+
+                expand_line(line_ptr, pixels_ptr, count);
+            }
+
+
+            inline const bool has_met_bad_indices() const noexcept
+            {
+                return _bad_indices_met;
+            }
+
+
+        private:
+            std::array<PixelT, 256 * PIXELS_PER_BYTE> _pixels{};
+            std::array<bool, 256> _bad_bytes{};
+            std::uint32_t _colors_count{ 0 };
+            bool _bad_indices_met{ false };
+
+
+            static inline const std::uint32_t _get_index(const std::uint8_t byte, const std::size_t pixel_rank) noexcept
+            {
+                // notice: the leftmost pixel is encoded in the most significant bits
+                return (byte >> (8 - BITS_PER_PIXEL * (pixel_rank + 1))) & INDEX_MASK;
+            }
+
+        };
+
+
+        //===========================================================================
+        // The color map converted once into the final pixel type, with bad indices mapped to entry 0, so that lookups need no check
+        template<typename PixelT>
+        class PaletteTable
+        {
+        public:
+            void build(const bmpl::frmt::BMPColorMap& color_map) noexcept
+            {
+                _colors_count = color_map.colors_count;
+                _bad_indices_met = false;
+
+                for (std::uint32_t index = 0; index < 256; ++index)
+                    bmpl::clr::convert(_pixels[index], color_map.data()[(index < _colors_count) ? index : 0]);
+            }
+
+
+            inline void check_index(const std::uint32_t index) noexcept
+            {
+                _bad_indices_met |= index >= _colors_count;
+            }
+
+
+            void check_indices(const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+            {
+                // notice: full palettes get no bad index; otherwise this max reduction gets vectorized by compilers
+                if (_colors_count >= 256)
+                    return;
+
+                std::uint8_t max_index{ 0 };
+                for (std::size_t i = 0; i < count; ++i)
+                    max_index = (indices_ptr[i] > max_index) ? indices_ptr[i] : max_index;
+
+                _bad_indices_met |= std::uint32_t(max_index) >= _colors_count;
+            }
+
+
+            inline void expand_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t width) noexcept
+            {
+                check_indices(line_ptr, width);
+                bmpl::bmpf::gather_palette_line(pixels_ptr, _pixels.data(), line_ptr, width);
+            }
+
+
+            inline const bool has_met_bad_indices() const noexcept
+            {
+                return _bad_indices_met;
+            }
+
+
+            inline const PixelT& operator[] (const std::uint8_t index) const noexcept
+            {
+                return _pixels[index];
+            }
+
+
+        private:
+            std::array<PixelT, 256> _pixels{};
+            std::uint32_t _colors_count{ 0 };
+            bool _bad_indices_met{ false };
+
+        };
+
+
         //===========================================================================
         template<typename PixelT>
         class BitmapLoaderBase : public bmpl::utils::ErrorStatus, public bmpl::utils::WarningStatus
         {
         public:
 
-            bmpl::utils::LEInStream&             in_stream{};
-            const bmpl::frmt::BMPFileHeaderBase* file_header_ptr{ nullptr };
-            const bmpl::frmt::BMPInfoHeaderBase* info_header_ptr{ nullptr };
-            bmpl::frmt::BMPColorMap              color_map{};
+            bmpl::utils::LEInStream&             in_stream{};
+            const bmpl::frmt::BMPFileHeaderBase* file_header_ptr{ nullptr };
+            const bmpl::frmt::BMPInfoHeaderBase* info_header_ptr{ nullptr };
+            bmpl::frmt::BMPColorMap              color_map{};
+
+
+            using MyErrBaseClass = bmpl::utils::ErrorStatus;
+            using MyWarnBaseClass = bmpl::utils::WarningStatus;
+
+
+            inline BitmapLoaderBase() noexcept = default;
+            inline virtual ~BitmapLoaderBase() noexcept = default;
+
+
+            BitmapLoaderBase(
+                bmpl::utils::LEInStream& in_stream_,
+                const bmpl::frmt::BMPFileHeaderBase* file_header_ptr_,
+                const bmpl::frmt::BMPInfoHeaderBase* info_header_ptr_,
+                bmpl::frmt::BMPColorMap& color_map_
+            )
+                : MyErrBaseClass()
+                , MyWarnBaseClass()
+                , in_stream(in_stream_)
+                , file_header_ptr(file_header_ptr_)
+                , info_header_ptr(info_header_ptr_)
+                , color_map(color_map_)
+            {
+                if (in_stream.failed())
+                    _set_err(in_stream.get_error());
+                else if (file_header_ptr_ == nullptr)
+                    _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
+                else if (file_header_ptr->failed())
+                    _set_err(file_header_ptr->get_error());
+                else if (info_header_ptr == nullptr)
+                    _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
+                else if (info_header_ptr->failed() && !file_header_ptr->is_BA_file())
+                    _set_err(info_header_ptr->get_error());
+                else if (color_map.failed())
+                    _set_err(color_map.get_error());
+                else
+                    _clr_err();
+            }
+
+
+            inline const std::uint32_t get_height() const noexcept
+            {
+                if (info_header_ptr != nullptr)
+                    return info_header_ptr->get_height();
+                else
+                    return 0;
+            }
+
+
+            inline const std::uint32_t get_width() const noexcept
+            {
+                if (info_header_ptr != nullptr)
+                    return info_header_ptr->get_width();
+                else
+                    return 0;
+            }
+
+
+            inline const std::size_t get_size() const noexcept
+            {
+                return std::size_t(get_width()) * std::size_t(get_height());
+            }
+
+
+            inline virtual void set_hdr_tone_mapping(const bool /*tone_mapping*/) noexcept
+            {
+                // notice: only HDR bitmaps get tone mapped, while they are decoded
+            }
+
+
+            inline void set_memory_resource(bmpl::utils::MemoryResource* resource_ptr) noexcept
+            {
+                // notice: the decoding buffers get their memory from this resource
+                _memory_resource_ptr = (resource_ptr != nullptr) ? resource_ptr : bmpl::utils::get_default_memory_resource();
+            }
+
+
+            inline virtual const bool load(const ImageRows<PixelT>& image_rows, const PixelT& /*default_pixel*/) noexcept
+            {
+                // notice: every pixel of line-based bitmaps gets decoded, so default_pixel is of no use here
+                std::size_t line_size, line_stride;
+                if (!this->_prepare_lines(line_size, line_stride))
+                    return false;
+
+                // bitmaps with same layout as the image content get read straight into it
+                if (this->_direct_copy)
+                    return this->_load_direct(image_rows, line_size, line_stride);
+
+                if (!this->_decode_lines(image_rows, 0, std::size_t(this->get_width()), std::size_t(this->get_height()), line_size, line_stride))
+                    return false;
+
+                this->_end_lines();
+
+                // once here, everything was fine!
+                return this->_clr_err();
+            }
+
+
+            inline virtual const bool load_region(const ImageRows<PixelT>& region_rows, const ImageRegion& region, const PixelT& /*default_pixel*/) noexcept
+            {
+                // notice: the region has been validated against the bitmap dimensions before
+                std::size_t line_size, line_stride;
+                if (!this->_prepare_lines(line_size, line_stride))
+                    return false;
+
+                // the lines before the region get skipped with no read
+                if (region.y > 0 && this->in_stream.seekg(this->in_stream.tellg() + bmpl::utils::LEInStream::pos_type(region.y * line_stride)).fail())
+                    return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
+
+                // then, only the pixels of the region get decoded in its lines
+                if (!this->_decode_lines(region_rows, region.x, region.width, region.height, line_size, line_stride))
+                    return false;
+
+                this->_end_lines();
+
+                // once here, everything was fine!
+                return this->_clr_err();
+            }
+
+
+            inline virtual const bool load_rows(const DecodedRowCallback<PixelT>& row_callback, const PixelT& default_pixel) noexcept
+            {
+                std::size_t line_size, line_stride;
+                if (!this->_prepare_lines(line_size, line_stride))
+                    return false;
+
+                const std::size_t width{ std::size_t(this->get_width()) };
+                const std::size_t height{ std::size_t(this->get_height()) };
+
+                // notice: only one line of bitmap and one row of pixels are kept in memory, while the source may read ahead the next ones
+                this->in_stream.will_need(this->_get_bitmap_size(line_stride, line_size, height));
+                BytesBuffer buffer(this->_memory_resource_ptr);
+                bmpl::utils::ResourceVector<PixelT> row(this->_memory_resource_ptr);
+                try {
+                    row.assign(width, default_pixel);
+                }
+                catch (...) {
+                    return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_IMAGE_DIMENSIONS);
+                }
+
+                for (std::size_t line = 0; line < height; ++line) {
+                    const std::uint8_t* line_ptr{ nullptr };
+                    if (!this->_get_bitmap_bytes(line_ptr, buffer, (line + 1 < height) ? line_stride : line_size))
+                        return false;
+
+                    this->_decode_line(line_ptr, row.data(), 0, width);
+                    if (!row_callback(std::uint32_t(line), row.data(), std::uint32_t(width)))
+                        return this->_set_err(bmpl::utils::ErrorCode::ROWS_STREAMING_CANCELLED);
+                }
+
+                this->_end_lines();
+
+                // once here, everything was fine!
+                return this->_clr_err();
+            }
 
 
-            using MyErrBaseClass = bmpl::utils::ErrorStatus;
-            using MyWarnBaseClass = bmpl::utils::WarningStatus;
+        protected:
+            bmpl::utils::MemoryResource* _memory_resource_ptr{ bmpl::utils::get_default_memory_resource() };
+            bool _direct_copy{ false };  // notice: set by _prepare_lines() when bitmap lines are unpadded and bit-identical to image rows, but maybe for their alpha component
 
 
-            inline BitmapLoaderBase() noexcept = default;
-            inline virtual ~BitmapLoaderBase() noexcept = default;
+            inline virtual const bool _prepare_lines(std::size_t& /*line_size*/, std::size_t& /*line_stride*/) noexcept
+            {
+                // notice: not line-based bitmaps have nothing to prepare
+                return false;
+            }
 
 
-            BitmapLoaderBase(
-                bmpl::utils::LEInStream& in_stream_,
-                const bmpl::frmt::BMPFileHeaderBase* file_header_ptr_,
-                const bmpl::frmt::BMPInfoHeaderBase* info_header_ptr_,
-                bmpl::frmt::BMPColorMap& color_map_
-            )
-                : MyErrBaseClass()
-                , MyWarnBaseClass()
-                , in_stream(in_stream_)
-                , file_header_ptr(file_header_ptr_)
-                , info_header_ptr(info_header_ptr_)
-                , color_map(color_map_)
+            inline virtual void _fix_up_direct_pixels(PixelT* /*pixels_ptr*/, const std::size_t /*pixels_count*/) noexcept
+            {}
+
+
+            inline virtual void _decode_line(const std::uint8_t* /*line_ptr*/, PixelT* /*pixels_ptr*/, const std::size_t /*first_x*/, const std::size_t /*count*/) noexcept
             {
-                if (in_stream.failed())
-                    _set_err(in_stream.get_error());
-                else if (file_header_ptr_ == nullptr)
-                    _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
-                else if (file_header_ptr->failed())
-                    _set_err(file_header_ptr->get_error());
-                else if (info_header_ptr == nullptr)
-                    _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
-                else if (info_header_ptr->failed() && !file_header_ptr->is_BA_file())
-                    _set_err(info_header_ptr->get_error());
-                else if (color_map.failed())
-                    _set_err(color_map.get_error());
-                else
-                    _clr_err();
+                // notice: decodes count pixels of the line, starting at its pixel first_x
             }
 
 
-            inline const std::uint32_t get_height() const noexcept
+            inline virtual void _end_lines() noexcept
+            {}
+
+
+            const bool _end_content(ImageContentOutput<PixelT>& output, const bool decoded) noexcept
             {
-                if (info_header_ptr != nullptr)
-                    return info_header_ptr->get_height();
-                else
-                    return 0;
+                // notice: the image content is fully set even when decoding failed, so that no uninitialized memory can be read
+                output.flush();
+                return decoded;
             }
 
 
-            inline const std::uint32_t get_width() const noexcept
+            const bool _end_content(RegionOutput<PixelT>& output, const bool decoded) noexcept
             {
-                if (info_header_ptr != nullptr)
-                    return info_header_ptr->get_width();
-                else
-                    return 0;
+                // notice: as with the whole image content, the region is fully set even when decoding failed
+                output.flush();
+                return decoded;
             }
 
 
-            inline const std::size_t get_size() const noexcept
+            const bool _end_rows(RowsOutput<PixelT>& output, const bool decoded) noexcept
             {
-                return std::size_t(get_width()) * std::size_t(get_height());
+                if (output.is_cancelled() || (decoded && !output.flush()))
+                    return this->_set_err(bmpl::utils::ErrorCode::ROWS_STREAMING_CANCELLED);
+                return decoded;
             }
 
 
-            inline virtual const bool load(std::vector<PixelT>& image_content) noexcept
+            const bool _decode_lines(
+                const ImageRows<PixelT>& image_rows,
+                const std::size_t first_x,
+                const std::size_t pixels_count,
+                const std::size_t lines_count,
+                const std::size_t line_size,
+                const std::size_t line_stride
+            ) noexcept
             {
-                return false;
+                // notice: the lines get decoded from the current position in stream
+                const std::size_t bitmap_size{ this->_get_bitmap_size(line_stride, line_size, lines_count) };
+
+                // memory mapped streams directly provide their whole content, with no copy
+                const std::uint8_t* bitmap_ptr{ this->in_stream.get_contiguous_view(bitmap_size) };
+                if (bitmap_ptr != nullptr) {
+                    for (std::size_t line = 0; line < lines_count; ++line)
+                        this->_decode_line(bitmap_ptr + line * line_stride, image_rows.get_row(line), first_x, pixels_count);
+                    return true;
+                }
+
+                // otherwise, the bitmap gets read through a bounded buffer, blocks of lines after blocks of lines, while the source may read ahead the next ones
+                this->in_stream.will_need(bitmap_size);
+                const std::size_t block_lines_count{ (line_stride < LINES_BLOCK_SIZE) ? LINES_BLOCK_SIZE / line_stride : 1 };
+                BytesBuffer buffer(this->_memory_resource_ptr);
+
+                for (std::size_t line = 0; line < lines_count; ) {
+                    const std::size_t block_count{ std::min(block_lines_count, lines_count - line) };
+                    const std::size_t block_size{ (line + block_count < lines_count) ? block_count * line_stride : this->_get_bitmap_size(line_stride, line_size, block_count) };
+                    if (!this->_get_bitmap_bytes(bitmap_ptr, buffer, block_size))
+                        return false;
+
+                    for (std::size_t block_line = 0; block_line < block_count; ++block_line)
+                        this->_decode_line(bitmap_ptr + block_line * line_stride, image_rows.get_row(line + block_line), first_x, pixels_count);
+                    line += block_count;
+                }
+
+                return true;
+            }
+
+
+            const bool _get_bitmap_bytes(
+                const std::uint8_t*& bitmap_ptr,
+                BytesBuffer& buffer,
+                const std::size_t bitmap_size
+            ) noexcept
+            {
+                // memory mapped streams directly provide their content, with no copy
+                bitmap_ptr = this->in_stream.get_contiguous_view(bitmap_size);
+                if (bitmap_ptr != nullptr)
+                    return this->_clr_err();
+
+                // otherwise, the requested bytes get loaded at once into the buffer
+                try {
+                    buffer.resize(bitmap_size);
+                }
+                catch (...) {
+                    return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+                }
+                if (!this->_read_bytes(buffer.data(), bitmap_size))
+                    return false;
+
+                bitmap_ptr = buffer.data();
+                return this->_clr_err();
+            }
+
+
+            const bool _read_bytes(void* dst_ptr, const std::size_t size) noexcept
+            {
+                if (!(this->in_stream.read(reinterpret_cast<char*>(dst_ptr), size))) {
+                    if (this->in_stream.eof())
+                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
+                    else
+                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+                }
+                return true;
+            }
+
+
+            const bool _load_direct(const ImageRows<PixelT>& image_rows, const std::size_t line_size, const std::size_t line_stride) noexcept
+            {
+                const std::size_t width{ std::size_t(this->get_width()) };
+                const std::size_t height{ std::size_t(this->get_height()) };
+                const std::size_t bitmap_size{ this->_get_bitmap_size(line_stride, line_size, height) };
+
+                // notice: bitmaps get copied straight into the image content only when their lines are not padded
+                if (image_rows.row_stride == std::ptrdiff_t(line_size)) {
+                    // same rows ordering: memory mapped streams get their content copied at once, other ones get read straight into the image content
+                    const std::uint8_t* bitmap_ptr{ this->in_stream.get_contiguous_view(bitmap_size) };
+                    if (bitmap_ptr != nullptr)
+                        std::memcpy(image_rows.get_row(0), bitmap_ptr, bitmap_size);
+                    else if (!this->_read_bytes(image_rows.get_row(0), bitmap_size))
+                        return false;
+                    this->_fix_up_direct_pixels(image_rows.get_row(0), width * height);
+                }
+                else {
+                    // otherwise, lines get copied or read one after the other straight into their final rows
+                    const std::uint8_t* bitmap_ptr{ this->in_stream.get_contiguous_view(bitmap_size) };
+                    if (bitmap_ptr == nullptr)
+                        this->in_stream.will_need(bitmap_size);
+                    for (std::size_t line = 0; line < height; ++line) {
+                        PixelT* row_ptr{ image_rows.get_row(line) };
+                        if (bitmap_ptr != nullptr)
+                            std::memcpy(row_ptr, bitmap_ptr + line * line_stride, line_size);
+                        else if (!this->_read_bytes(row_ptr, line_size))
+                            return false;
+                        this->_fix_up_direct_pixels(row_ptr, width);
+                    }
+                }
+
+                this->_end_lines();
+
+                // once here, everything was fine!
+                return this->_clr_err();
+            }
+
+
+            static inline const std::size_t _get_bitmap_size(
+                const std::size_t line_stride,
+                const std::size_t line_size,
+                const std::size_t lines_count
+            ) noexcept
+            {
+                // notice: the padding at end of the very last line is not mandatory
+                return (lines_count > 0) ? line_stride * (lines_count - 1) + line_size : 0;
+            }
+
+
+            static constexpr std::size_t LINES_BLOCK_SIZE{ 262144 };  // notice: bitmap lines are read per blocks of at most this size, or line per line for wider lines
+            static constexpr std::size_t RLE_WINDOW_SIZE{ 16384 };
+            static constexpr std::size_t RLE_LOOKAHEAD_SIZE{ 1024 };  // notice: greater than the longest RLE opcode, i.e. absolute mode with 255 24-bits pixels
+
+
+            const bool _get_rle_window(
+                const std::uint8_t*& bitmap_ptr,
+                const std::uint8_t*& bitmap_end,
+                BytesBuffer& buffer,
+                std::size_t& remaining_size,
+                const bool bounded_by_file_size
+            ) noexcept
+            {
+                // the size of the RLE bitmap is bounded by its info header value, when set and coherent, and never exceeds the bytes left in source
+                const bmpl::utils::LEInStream::pos_type available_size{ this->in_stream.get_size() - this->in_stream.tellg() };
+                if (available_size < 0)
+                    return this->_set_err(bmpl::utils::ErrorCode::ERRONEOUS_BITMAP_OFFSET);
+
+                const std::size_t header_bitmap_size{ this->info_header_ptr->get_bitmap_size() };
+                std::size_t bitmap_size{ std::size_t(available_size) };
+                if (header_bitmap_size > 0 && header_bitmap_size <= bitmap_size) {
+                    bitmap_size = header_bitmap_size;
+                }
+                else if (bounded_by_file_size) {
+                    // notice: otherwise, the bitmap ends with the file, which must then not end before the bitmap starts
+                    const std::size_t file_size{ this->file_header_ptr->get_file_size() };
+                    const std::size_t content_offset{ this->file_header_ptr->get_content_offset() };
+                    if (file_size < content_offset)
+                        return this->_set_err(bmpl::utils::ErrorCode::ERRONEOUS_BITMAP_OFFSET);
+                    bitmap_size = std::min(bitmap_size, file_size - content_offset);
+                }
+
+                // sources with views are directly parsed, with no copy
+                remaining_size = 0;
+                bitmap_ptr = this->in_stream.get_contiguous_view(bitmap_size);
+                if (bitmap_ptr != nullptr) {
+                    bitmap_end = bitmap_ptr + bitmap_size;
+                    return this->_clr_err();
+                }
+
+                // otherwise, the bitmap gets parsed through a fixed-size sliding window, while the source may read ahead its next content
+                this->in_stream.will_need(bitmap_size);
+                try {
+                    buffer.resize((bitmap_size < RLE_WINDOW_SIZE) ? bitmap_size : RLE_WINDOW_SIZE);
+                }
+                catch (...) {
+                    return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+                }
+
+                remaining_size = bitmap_size;
+                bitmap_ptr = bitmap_end = buffer.data();
+                return _slide_rle_window(bitmap_ptr, bitmap_end, buffer, remaining_size);
+            }
+
+
+            const bool _slide_rle_window(
+                const std::uint8_t*& bmp_it,
+                const std::uint8_t*& bitmap_end,
+                BytesBuffer& buffer,
+                std::size_t& remaining_size
+            ) noexcept
+            {
+                // notice: nothing to be done if the whole bitmap is already in window or if enough bytes are left in it
+                const std::size_t kept_size{ std::size_t(bitmap_end - bmp_it) };
+                if (remaining_size == 0 || kept_size >= RLE_LOOKAHEAD_SIZE)
+                    return true;
+
+                std::memmove(buffer.data(), bmp_it, kept_size);
+
+                const std::size_t read_size{ std::min(remaining_size, buffer.size() - kept_size) };
+                if (!(this->in_stream.read(reinterpret_cast<char*>(buffer.data() + kept_size), read_size))) {
+                    if (this->in_stream.eof())
+                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
+                    else
+                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+                }
+
+                remaining_size -= read_size;
+                bmp_it = buffer.data();
+                bitmap_end = bmp_it + kept_size + read_size;
+                return true;
             }
 
         };
@@ -155,7 +1160,65 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+            virtual void _end_lines() noexcept override;
+
+
+        private:
+            PackedIndicesTable<PixelT, 1> _indices_table{};
+
+        };
+
+
+        //===========================================================================
+        // OS/2 2 colors bitmaps encoded with the CCITT T.4 Modified Huffman codes (i.e. Huffman-1D)
+        template<typename PixelT>
+        class BitmapLoader1bitHuffman1D : public BitmapLoaderBase<PixelT>
+        {
+        public:
+
+            using MyBaseClass = BitmapLoaderBase<PixelT>;
+
+            inline BitmapLoader1bitHuffman1D(
+                bmpl::utils::LEInStream& in_stream,
+                const bmpl::frmt::BMPFileHeaderBase* file_header_ptr,
+                const bmpl::frmt::BMPInfoHeaderBase* info_header_ptr,
+                bmpl::frmt::BMPColorMap& color_map
+            ) noexcept
+                : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
+            {}
+
+            inline virtual const bool load(const ImageRows<PixelT>& image_rows, const PixelT& default_pixel) noexcept override
+            {
+                ImageContentOutput<PixelT> output(image_rows, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_region(const ImageRows<PixelT>& region_rows, const ImageRegion& region, const PixelT& default_pixel) noexcept override
+            {
+                RegionOutput<PixelT> output(region_rows, region, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_rows(const DecodedRowCallback<PixelT>& row_callback, const PixelT& default_pixel) noexcept override
+            {
+                RowsOutput<PixelT> output(row_callback, default_pixel, this->get_width(), this->get_height(), this->_memory_resource_ptr);
+                return this->_end_rows(output, _decode(output));
+            }
+
+
+        protected:
+            template<typename OutputT>
+            const bool _decode(OutputT& output) noexcept;
+
+
+        private:
+            PaletteTable<PixelT> _palette{};
 
         };
 
@@ -177,7 +1240,17 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+            virtual void _end_lines() noexcept override;
+
+
+        private:
+            PackedIndicesTable<PixelT, 2> _indices_table{};
 
         };
 
@@ -199,7 +1272,17 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+            virtual void _end_lines() noexcept override;
+
+
+        private:
+            PackedIndicesTable<PixelT, 4> _indices_table{};
 
         };
 
@@ -221,7 +1304,32 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+            inline virtual const bool load(const ImageRows<PixelT>& image_rows, const PixelT& default_pixel) noexcept override
+            {
+                ImageContentOutput<PixelT> output(image_rows, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_region(const ImageRows<PixelT>& region_rows, const ImageRegion& region, const PixelT& default_pixel) noexcept override
+            {
+                RegionOutput<PixelT> output(region_rows, region, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_rows(const DecodedRowCallback<PixelT>& row_callback, const PixelT& default_pixel) noexcept override
+            {
+                RowsOutput<PixelT> output(row_callback, default_pixel, this->get_width(), this->get_height(), this->_memory_resource_ptr);
+                return this->_end_rows(output, _decode(output));
+            }
+
+
+        protected:
+            template<typename OutputT>
+            const bool _decode(OutputT& output) noexcept;
+
+
+        private:
+            PaletteTable<PixelT> _palette{};
 
         };
 
@@ -243,7 +1351,17 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+            virtual void _end_lines() noexcept override;
+
+
+        private:
+            PaletteTable<PixelT> _palette{};
 
         };
 
@@ -265,7 +1383,32 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+            inline virtual const bool load(const ImageRows<PixelT>& image_rows, const PixelT& default_pixel) noexcept override
+            {
+                ImageContentOutput<PixelT> output(image_rows, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_region(const ImageRows<PixelT>& region_rows, const ImageRegion& region, const PixelT& default_pixel) noexcept override
+            {
+                RegionOutput<PixelT> output(region_rows, region, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_rows(const DecodedRowCallback<PixelT>& row_callback, const PixelT& default_pixel) noexcept override
+            {
+                RowsOutput<PixelT> output(row_callback, default_pixel, this->get_width(), this->get_height(), this->_memory_resource_ptr);
+                return this->_end_rows(output, _decode(output));
+            }
+
+
+        protected:
+            template<typename OutputT>
+            const bool _decode(OutputT& output) noexcept;
+
+
+        private:
+            PaletteTable<PixelT> _palette{};
 
         };
 
@@ -287,7 +1430,16 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+
+        private:
+            BitfieldsLineDecoder<PixelT> _bitfields_decoder{};
+            std::shared_ptr<const Bitfields16Table<PixelT>> _table_ptr{};
 
         };
 
@@ -309,7 +1461,11 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
 
         };
 
@@ -331,7 +1487,28 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+            inline virtual const bool load(const ImageRows<PixelT>& image_rows, const PixelT& default_pixel) noexcept override
+            {
+                ImageContentOutput<PixelT> output(image_rows, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_region(const ImageRows<PixelT>& region_rows, const ImageRegion& region, const PixelT& default_pixel) noexcept override
+            {
+                RegionOutput<PixelT> output(region_rows, region, default_pixel, this->get_width(), this->get_height());
+                return this->_end_content(output, _decode(output));
+            }
+
+            inline virtual const bool load_rows(const DecodedRowCallback<PixelT>& row_callback, const PixelT& default_pixel) noexcept override
+            {
+                RowsOutput<PixelT> output(row_callback, default_pixel, this->get_width(), this->get_height(), this->_memory_resource_ptr);
+                return this->_end_rows(output, _decode(output));
+            }
+
+
+        protected:
+            template<typename OutputT>
+            const bool _decode(OutputT& output) noexcept;
 
         };
 
@@ -353,7 +1530,18 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+            virtual void _fix_up_direct_pixels(PixelT* pixels_ptr, const std::size_t pixels_count) noexcept override;
+
+
+        private:
+            BitfieldsLineDecoder<PixelT> _bitfields_decoder{};
+            bool _zero_alpha{ false };
 
         };
 
@@ -375,7 +1563,21 @@ namespace bmpl
                 : MyBaseClass(in_stream, file_header_ptr, info_header_ptr, color_map)
             {}
 
-            virtual const bool load(std::vector<PixelT>& image_content) noexcept override;
+            inline virtual void set_hdr_tone_mapping(const bool tone_mapping) noexcept override
+            {
+                _tone_mapping = tone_mapping;
+            }
+
+
+        protected:
+            virtual const bool _prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept override;
+
+            virtual void _decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept override;
+
+
+        private:
+            std::array<std::uint8_t, 256> _tone_levels{};
+            bool _tone_mapping{ false };
 
         };
 
@@ -401,7 +1603,10 @@ namespace bmpl
             switch (info_header_ptr->bits_per_pixel)
             {
             case 1:
-                return new BitmapLoader1bit<PixelT>(in_stream, file_header_ptr, info_header_ptr, color_map);
+                if (info_header_ptr->is_vOS22() && info_header_ptr->compression_mode == info_header_ptr->COMPR_HUFFMAN_1D)
+                    return new BitmapLoader1bitHuffman1D<PixelT>(in_stream, file_header_ptr, info_header_ptr, color_map);
+                else
+                    return new BitmapLoader1bit<PixelT>(in_stream, file_header_ptr, info_header_ptr, color_map);
 
             case 2:
                 return new BitmapLoader2bits<PixelT>(in_stream, file_header_ptr, info_header_ptr, color_map);
@@ -433,83 +1638,152 @@ namespace bmpl
             case 64:
                 return new BitmapLoader64bits<PixelT>(in_stream, file_header_ptr, info_header_ptr, color_map);
 
-            default:
-                return nullptr;
-            }
+            default:
+                return nullptr;
+            }
+        }
+
+
+
+        //===========================================================================
+        template<typename PixelT>
+        const bool BitmapLoader1bit<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
+        {
+            if (this->info_header_ptr == nullptr)
+                return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
+
+            if (this->info_header_ptr->compression_mode != this->info_header_ptr->COMPR_NO_RLE) {
+                // no Run Length Encoding is defined by Windows for 2 colors mapped bitmaps
+                return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+            }
+
+            line_size = (std::size_t(this->get_width()) + 7) / 8;
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
+
+            this->_indices_table.build(this->color_map);
+            return true;
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader1bit<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            this->_indices_table.expand_span(line_ptr, pixels_ptr, first_x, count);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader1bit<PixelT>::_end_lines() noexcept
+        {
+            if (this->_indices_table.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
         }
 
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader1bit<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        template<typename OutputT>
+        const bool BitmapLoader1bitHuffman1D<PixelT>::_decode(OutputT& output) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
 
-            if (this->info_header_ptr->compression_mode != this->info_header_ptr->COMPR_NO_RLE) {
-                // no Run Length Encoding is defined by Windows for 2 colors mapped bitmaps
+            if (this->info_header_ptr->compression_mode != this->info_header_ptr->COMPR_HUFFMAN_1D) {
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t index_width{ std::size_t(std::ceil(width / 8.0f)) };
-            const std::size_t index_height{ std::size_t(this->get_height()) };
+            // gets access to the Huffman-1D bitmap
+            BytesBuffer buffer(this->_memory_resource_ptr);
+            const std::uint8_t* bitmap_ptr{ nullptr };
+            const std::uint8_t* bitmap_end{ nullptr };
+            std::size_t remaining_size{ 0 };
+            if (!this->_get_rle_window(bitmap_ptr, bitmap_end, buffer, remaining_size, true))
+                return false;
 
-            std::vector<std::uint8_t> indexed_content;
-            indexed_content.assign(index_width * index_height, 0);
-            
-            // loads the indexed content
-            if (index_width % 4 == 0) {
-                // cool, no padding at end of each line
-                // let's load the whole image content at once
-                if (!(this->in_stream.read(reinterpret_cast<char*>(indexed_content.data()), index_width * index_height)))
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            }
-            else {
-                // let's load the image content line after line
-                const std::size_t padding_size{ bmpl::bmpf::evaluate_padding(width) };
+            this->_palette.build(this->color_map);
+            const Huffman1DTables& tables{ get_huffman_1d_tables() };
+
+            // notice: white runs get palette index 0 and black runs palette index 1, as with the "min-is-white" fax images
+            const PixelT white_pxl_value{ this->_palette[0] };
+            const PixelT black_pxl_value{ this->_palette[1] };
+
+            // parses then the Huffman-1D bitmap, each line starting with a white run
+            const std::uint32_t width{ std::uint32_t(this->get_width()) };
+            const std::uint32_t height{ std::uint32_t(this->get_height()) };
+            std::uint64_t bits{ 0 };  // notice: the next bits of the bitmap, most significant bit first
+            std::uint32_t bits_count{ 0 };
+
+            auto bmp_it{ bitmap_ptr };
+
+            for (std::uint32_t num_line = 0; num_line < height && !output.is_done(); ++num_line) {
+                std::uint32_t x{ 0 };
+                std::uint32_t run_length{ 0 };
+                bool is_white_run{ true };
+
+                while (x < width) {
+                    // refills the bits with the next bytes of the bitmap
+                    if (bits_count <= 56) {
+                        if (!this->_slide_rle_window(bmp_it, bitmap_end, buffer, remaining_size))
+                            return false;
+                        for (; bits_count <= 56 && bmp_it != bitmap_end; bits_count += 8)
+                            bits |= std::uint64_t(*bmp_it++) << (56 - bits_count);
+                    }
 
-                char* current_line_ptr{ reinterpret_cast<char*>(indexed_content.data()) };
-                for (int line = 0; line < index_height; ++line) {
-                    if (!(this->in_stream.read(current_line_ptr, index_width))) {
-                        if (this->in_stream.eof())
-                            return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                        else
-                            return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+                    if (bits_count == 0) {
+                        // the bitmap ends before its last line
+                        return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                     }
 
-                    if (padding_size > 0 && (this->in_stream.seekg(padding_size, std::ios_base::cur)).fail()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
+                    if ((bits >> 56) == 0) {
+                        // End Of Line code, maybe preceded with fill bits - allowed before lines only
+                        if (x > 0 || run_length > 0) {
+                            return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                        }
+                        for (; bits_count > 0 && (bits >> 63) == 0; --bits_count)
+                            bits <<= 1;
+                        if (bits_count > 0) {
+                            bits <<= 1;
+                            --bits_count;
+                        }
+                        continue;
                     }
 
-                    current_line_ptr += index_width;
-                }
-            }
+                    // notice: any code gets decoded with a single lookup
+                    const Huffman1DCode& code{ (is_white_run ? tables.white : tables.black)[std::size_t(bits >> (64 - HUFFMAN_1D_LOOKUP_BITS))] };
+                    if (code.bits_count == 0 || code.bits_count > bits_count) {
+                        return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                    }
+                    bits <<= code.bits_count;
+                    bits_count -= code.bits_count;
 
-            // evaluates the final image content
-            std::size_t line_remaining_pixels{ width };
+                    run_length += code.run_length;
+                    if (x + run_length > width) {
+                        return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                    }
+                    if (code.run_length >= 64)
+                        continue;  // makeup code, the run ends with a terminating code
 
-            auto img_it{ image_content.begin() };
-            auto ndx_it{ indexed_content.cbegin() };
-            for (; ndx_it != indexed_content.cend(); ++ndx_it) {
-                for (std::uint8_t mask = 0x80; line_remaining_pixels > 0 && mask > 0 && img_it != image_content.end(); mask >>= 1) {
-                    bmpl::clr::convert(*img_it++, this->color_map[(*ndx_it & mask) != 0]);  // notice: "!= 0" is an optimization to avoid bits shifting
-                    --line_remaining_pixels;
+                    // terminating code, the whole run is expanded at once
+                    if (run_length > 0) {
+                        this->_palette.check_index(is_white_run ? 0 : 1);
+                        if (!output.can_write(run_length)) {
+                            return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
+                        }
+                        output.fill(run_length, is_white_run ? white_pxl_value : black_pxl_value);
+                    }
+                    x += run_length;
+                    run_length = 0;
+                    is_white_run = !is_white_run;
                 }
-                if (line_remaining_pixels == 0)
-                    line_remaining_pixels = width;
             }
 
-            if (img_it != image_content.end()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
-            }
-            else if (ndx_it != indexed_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-            }
+            // notice: the ending Return To Control codes, if any, are ignored
+
+            if (this->_palette.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
 
             // once here, everything was fine!
             return this->_clr_err();
@@ -519,7 +1793,7 @@ namespace bmpl
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader2bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader2bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
             // Notice: this is a specific case with Windows CE
             if (this->info_header_ptr == nullptr)
@@ -530,147 +1804,67 @@ namespace bmpl
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t index_width{ std::size_t(std::ceil(width / 4.0f)) };
-            const std::size_t index_height{ std::size_t(this->get_height()) };
-
-            std::vector<std::uint8_t> indexed_content;
-            indexed_content.assign(index_width * index_height, 0);
-
-            // loads the indexed content
-            if (index_width % 4 == 0) {
-                // cool, no padding at end of each line
-                // let's load the whole image content at once
-                if (!(this->in_stream.read(reinterpret_cast<char*>(indexed_content.data()), index_width * index_height)))
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            }
-            else {
-                // let's load the image content line after line
-                const std::size_t padding_size{ bmpl::bmpf::evaluate_padding(width) };
-
-                char* current_line_ptr{ reinterpret_cast<char*>(indexed_content.data()) };
-                for (int line = 0; line < index_height; ++line) {
-                    if (!(this->in_stream.read(current_line_ptr, index_width))) {
-                        if (this->in_stream.eof())
-                            return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                        else
-                            return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
-
-                    if (padding_size > 0 && (this->in_stream.seekg(padding_size, std::ios_base::cur)).fail()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    }
+            line_size = (std::size_t(this->get_width()) + 3) / 4;
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
 
-                    current_line_ptr += index_width;
-                }
-            }
+            this->_indices_table.build(this->color_map);
+            return true;
+        }
 
-            // evaluates the final image content
-            std::size_t line_remaining_pixels{ width };
 
-            auto img_it{ image_content.begin() };
-            auto ndx_it = indexed_content.cbegin();
-            for (; ndx_it != indexed_content.cend();  ++ndx_it) {
-                for (std::uint8_t mask = 0xc0, shift = 6; line_remaining_pixels > 0 && mask > 0 && img_it != image_content.end(); mask >>= 2, shift -= 2) {
-                    bmpl::clr::convert(*img_it++, this->color_map[(*ndx_it & mask) >> shift]);
-                    --line_remaining_pixels;
-                }
-                if (line_remaining_pixels == 0)
-                    line_remaining_pixels = width;
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader2bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            this->_indices_table.expand_span(line_ptr, pixels_ptr, first_x, count);
+        }
 
-            if (img_it != image_content.end()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
-            }
-            else if (ndx_it != indexed_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-            }
 
-            // once here, everything was fine!
-            return this->_clr_err();
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader2bits<PixelT>::_end_lines() noexcept
+        {
+            if (this->_indices_table.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
         }
 
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader4bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader4bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t index_width{ std::size_t(std::ceil(width / 2.0f)) };
-            const std::size_t index_height{ std::size_t(this->get_height()) };
-
-            std::vector<std::uint8_t> indexed_content;
-            indexed_content.assign(index_width * index_height, 0);
-
-            // loads the indexed content
-            if (index_width % 4 == 0) {
-                // cool, no padding at end of each line
-                // let's load the whole bitmap content at once
-                if (!(this->in_stream.read(reinterpret_cast<char*>(indexed_content.data()), index_width * index_height))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
-            }
-            else {
-                // let's load the bitmap content line after line
-                const std::size_t padding_size{ bmpl::bmpf::evaluate_padding(index_width) };
-
-                char* current_line_ptr{ reinterpret_cast<char*>(indexed_content.data()) };
-                for (int line = 0; line < index_height; ++line) {
-                    if (!(this->in_stream.read(current_line_ptr, index_width))) {
-                        if (this->in_stream.eof())
-                            return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                        else
-                            return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
+            line_size = (std::size_t(this->get_width()) + 1) / 2;
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
 
-                    if (padding_size > 0 && (this->in_stream.seekg(padding_size, std::ios_base::cur)).fail()) {
-                        return  this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    }
+            this->_indices_table.build(this->color_map);
+            return true;
+        }
 
-                    current_line_ptr += index_width;
-                }
-            }
 
-            // evaluates the final image content
-            std::size_t line_remaining_pixels{ width };
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader4bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            this->_indices_table.expand_span(line_ptr, pixels_ptr, first_x, count);
+        }
 
-            auto img_it{ image_content.begin() };
-            auto ndx_it{ indexed_content.cbegin() };
-            for (; ndx_it != indexed_content.cend() && img_it != image_content.end(); ++ndx_it)
-            {
-                bmpl::clr::convert(*img_it++, this->color_map[*ndx_it >> 4]);
-                if (--line_remaining_pixels > 0 && img_it != image_content.end()) {
-                    bmpl::clr::convert(*img_it++, this->color_map[*ndx_it & 0x0f]);
-                    --line_remaining_pixels;
-                }
-                if (line_remaining_pixels == 0)
-                    line_remaining_pixels = width;
-            }
 
-            if (img_it != image_content.end()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
-            }
-            else if (ndx_it != indexed_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader4bits<PixelT>::_end_lines() noexcept
+        {
+            if (this->_indices_table.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
 
             this->append_warnings(this->color_map);
-
-            // once here, everything was fine!
-            return this->_clr_err();
         }
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader4bitsRLE<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        template<typename OutputT>
+        const bool BitmapLoader4bitsRLE<PixelT>::_decode(OutputT& output) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
@@ -679,16 +1873,15 @@ namespace bmpl
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
-            // loads the RLE-4 bitmap
-            const std::size_t bitmap_size{ this->file_header_ptr->get_file_size() - this->file_header_ptr->get_content_offset() };
-            std::vector<std::uint8_t> bitmap;
-            bitmap.assign(bitmap_size, std::uint8_t(0));
-            if (!(this->in_stream.read(reinterpret_cast<char*>(bitmap.data()), bitmap_size))) {
-                if (this->in_stream.eof())
-                    return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                else
-                    return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            }
+            // gets access to the RLE-4 bitmap
+            BytesBuffer buffer(this->_memory_resource_ptr);
+            const std::uint8_t* bitmap_ptr{ nullptr };
+            const std::uint8_t* bitmap_end{ nullptr };
+            std::size_t remaining_size{ 0 };
+            if (!this->_get_rle_window(bitmap_ptr, bitmap_end, buffer, remaining_size, true))
+                return false;
+
+            this->_palette.build(this->color_map);
 
             // parses then the RLE-4 bitmap
             std::uint32_t width{ std::uint32_t(this->get_width()) };
@@ -696,18 +1889,19 @@ namespace bmpl
             std::uint32_t x{ 0 };
             bool encountered_eof{ false };
 
-            auto img_it{ image_content.begin() };
-            auto bmp_it = bitmap.cbegin();
+            auto bmp_it{ bitmap_ptr };
 
-            while (bmp_it != bitmap.cend()) {
+            while (!output.is_done() && this->_slide_rle_window(bmp_it, bitmap_end, buffer, remaining_size) && bmp_it != bitmap_end) {
                 if (*bmp_it > 0) {
                     // encoded mode, repetition of same pixel value n-times
                     std::uint8_t n_rep{ *bmp_it++ };
-                    PixelT pxl_value_0{}, pxl_value_1{};
-                    bmpl::clr::convert(pxl_value_0, this->color_map[*bmp_it >> 4]);
-                    bmpl::clr::convert(pxl_value_1, this->color_map[*bmp_it & 0x0f]);
-                    if (bmp_it != bitmap.cend())
-                        bmp_it++;
+                    std::uint8_t pxl_indices{ 0 };
+                    if (bmp_it != bitmap_end)
+                        pxl_indices = *bmp_it++;
+                    this->_palette.check_index(pxl_indices >> 4);
+                    this->_palette.check_index(pxl_indices & 0x0f);
+                    const PixelT pxl_value_0{ this->_palette[pxl_indices >> 4] };
+                    const PixelT pxl_value_1{ this->_palette[pxl_indices & 0x0f] };
 
                     if (x + std::uint32_t(n_rep) > width) {
                         this->set_warning(bmpl::utils::WarningCode::DELTA_MODE_MAY_OVERFLOW);
@@ -717,23 +1911,13 @@ namespace bmpl
                     else
                         x += n_rep;
 
-                    while (n_rep--) {
-                        if (img_it == image_content.end()) {
-                            return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                        }
-                        *img_it++ = pxl_value_0;
-                        if (n_rep) {
-                            if (img_it == image_content.end()) {
-                                return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                            }
-                            *img_it++ = pxl_value_1;
-                            --n_rep;
-                        }
-                        else
-                            break;  // shortcut, don't test twice n_rep to zero!
+                    // notice: the run is validated once, then expanded at once
+                    if (!output.can_write(n_rep)) {
+                        return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
                     }
+                    output.fill_pairs(n_rep, pxl_value_0, pxl_value_1);
                 }
-                else if (bmp_it != bitmap.cend() - 1) {
+                else if (bmp_it != bitmap_end - 1) {
                     bmp_it++;
                     switch (*bmp_it++)
                     {
@@ -744,13 +1928,16 @@ namespace bmpl
                         if (num_line == this->get_height()) {
                             return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                         }
-                        img_it = image_content.begin() + std::size_t(num_line * width);
+                        if (!output.move_to(std::size_t(num_line) * std::size_t(width))) {
+                            // notice: streamed rows cannot be modified once they have been delivered
+                            return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                        }
                         break;
 
                     case 1:
                         // end of bitmap
                         encountered_eof = true;
-                        if (bmp_it != bitmap.cend()) {
+                        if (bmp_it != bitmap_end || remaining_size > 0) {
                             return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                         }
                         break;
@@ -760,9 +1947,9 @@ namespace bmpl
                         // delta-mode
                         std::uint8_t delta_pxls{ 0 };
                         std::uint8_t delta_lines{ 0 };
-                        if (bmp_it != bitmap.cend())
+                        if (bmp_it != bitmap_end)
                             delta_pxls = *bmp_it++;
-                        if (bmp_it != bitmap.cend())
+                        if (bmp_it != bitmap_end)
                             delta_lines = *bmp_it++;
                         
                         if (x + delta_pxls > width) {
@@ -772,12 +1959,13 @@ namespace bmpl
                         }
                         else
                             x += delta_pxls;
+                        num_line += delta_lines;
 
                         const std::size_t offset{ std::size_t(delta_pxls) + std::size_t(width) * std::size_t(delta_lines) };
-                        if ((img_it - image_content.begin()) + offset > std::size_t(width) * this->get_height()) {
+                        if (output.get_index() + offset > std::size_t(width) * this->get_height()) {
                             return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_DELTA_MODE_VALUES);
                         }
-                        img_it += offset;
+                        output.move_to(output.get_index() + offset);
                     }
                     break;
 
@@ -786,7 +1974,6 @@ namespace bmpl
                         std::uint8_t absolute_pixels_count{ *(bmp_it - 1) };
                         const int mod4{ absolute_pixels_count % 4 };
                         const bool padding{ mod4 == 1 || mod4 == 2 };
-                        PixelT pxl_value{};
 
                         if (x + std::uint32_t(absolute_pixels_count) > width) {
                             this->set_warning(bmpl::utils::WarningCode::DELTA_MODE_MAY_OVERFLOW);
@@ -796,36 +1983,47 @@ namespace bmpl
                         else
                             x += absolute_pixels_count;
 
-                        while (absolute_pixels_count--) {
-                            bmpl::clr::convert(pxl_value, this->color_map[*bmp_it >> 4]);
-                            if (img_it == image_content.end()) {
-                                return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                            }
-                            *img_it++ = pxl_value;
-                            if (absolute_pixels_count) {
-                                bmpl::clr::convert(pxl_value, this->color_map[*bmp_it & 0x0f]);
-                                if (img_it == image_content.end()) {
-                                    return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                                }
-                                *img_it++ = pxl_value;
-                                --absolute_pixels_count;
+                        // notice: the pixels are validated once, and never read past the end of bitmap
+                        std::size_t pixels_count{ std::min(std::size_t(absolute_pixels_count), 2 * std::size_t(bitmap_end - bmp_it)) };
+                        if (!output.can_write(pixels_count)) {
+                            return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
+                        }
+                        while (pixels_count > 0) {
+                            this->_palette.check_index(*bmp_it >> 4);
+                            output.next() = this->_palette[*bmp_it >> 4];
+                            if (--pixels_count > 0) {
+                                this->_palette.check_index(*bmp_it & 0x0f);
+                                output.next() = this->_palette[*bmp_it & 0x0f];
+                                --pixels_count;
                             }
-                            if (bmp_it != bitmap.cend())
-                                bmp_it++;
+                            bmp_it++;
                         }
 
-                        if (padding && bmp_it != bitmap.cend())
+                        if (padding && bmp_it != bitmap_end)
                             bmp_it++;
 
                         break;
                     }
                 }
+                else {
+                    // notice: a lone escape byte ends the bitmap
+                    bmp_it++;
+                }
+            }
+
+            if (this->failed()) {
+                // some error happened while sliding the bitmap window
+                return false;
             }
 
-            if (!encountered_eof) {
+            if (!encountered_eof && !output.is_done()) {
+                // notice: decoding of regions ends as soon as their last line is done
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
+            if (this->_palette.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
+
             this->append_warnings(this->color_map);
 
             // once here, everything was fine!
@@ -835,70 +2033,40 @@ namespace bmpl
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader8bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader8bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t height{ std::size_t(this->get_height()) };
-
             //-- no Run Length Encoding --//
-            std::vector<std::uint8_t> indexed_content;
-            indexed_content.assign(width * height, 0);
-
-            // loads the indexed content
-            if (width % 4 == 0) {
-                // cool, no padding at end of each line
-                // let's load the whole image content at once
-                if (!(this->in_stream.read(reinterpret_cast<char*>(indexed_content.data()), width * height))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
-            }
-            else {
-                // let's load the image content line per line
-                const std::size_t padding_size{ bmpl::bmpf::evaluate_padding(width) };
+            line_size = std::size_t(this->get_width());
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
 
-                char* current_line_ptr{ reinterpret_cast<char*>(indexed_content.data()) };
-                for (int line = 0; line < height; ++line) {
-                    if (!(this->in_stream.read(current_line_ptr, width))) {
-                        if (this->in_stream.eof())
-                            return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                        else
-                            return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
+            this->_palette.build(this->color_map);
+            return true;
+        }
 
-                    if (padding_size > 0 && (this->in_stream.seekg(padding_size, std::ios_base::cur)).fail()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    }
 
-                    current_line_ptr += width;
-                }
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader8bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            this->_palette.expand_line(line_ptr + first_x, pixels_ptr, count);
+        }
 
-            // evaluates the final image content
-            auto img_it{ image_content.begin() };
-            auto ndx_it{ indexed_content.cbegin() };
-            while (ndx_it != indexed_content.cend() && img_it != image_content.end())
-                bmpl::clr::convert(*img_it++, this->color_map[*ndx_it++]);
 
-            if (img_it != image_content.end()) {
-                this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-            }
-            else if (ndx_it != indexed_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader8bits<PixelT>::_end_lines() noexcept
+        {
+            if (this->_palette.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
 
             this->append_warnings(this->color_map);
-
-            // once here, everything was fine!
-            return this->_clr_err();
         }
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader8bitsRLE<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        template<typename OutputT>
+        const bool BitmapLoader8bitsRLE<PixelT>::_decode(OutputT& output) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
@@ -907,16 +2075,15 @@ namespace bmpl
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
-            // loads the RLE-8 bitmap
-            const std::size_t bitmap_size{ this->file_header_ptr->get_file_size() - this->file_header_ptr->get_content_offset()};
-            std::vector<std::uint8_t> bitmap;
-            bitmap.assign(bitmap_size, std::uint8_t(0));
-            if (!(this->in_stream.read(reinterpret_cast<char*>(bitmap.data()), bitmap_size))) {
-                if (this->in_stream.eof())
-                    return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                else
-                    return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            }
+            // gets access to the RLE-8 bitmap
+            BytesBuffer buffer(this->_memory_resource_ptr);
+            const std::uint8_t* bitmap_ptr{ nullptr };
+            const std::uint8_t* bitmap_end{ nullptr };
+            std::size_t remaining_size{ 0 };
+            if (!this->_get_rle_window(bitmap_ptr, bitmap_end, buffer, remaining_size, true))
+                return false;
+
+            this->_palette.build(this->color_map);
 
             // parses then the RLE-8 bitmap
             std::uint32_t width{ std::uint32_t(this->get_width()) };
@@ -924,17 +2091,17 @@ namespace bmpl
             std::uint32_t x{ 0 };
             bool encountered_eof{ false };
 
-            auto img_it{ image_content.begin() };
-            auto bmp_it{ bitmap.cbegin() };
+            auto bmp_it{ bitmap_ptr };
 
-            while (bmp_it != bitmap.cend()) {
+            while (!output.is_done() && this->_slide_rle_window(bmp_it, bitmap_end, buffer, remaining_size) && bmp_it != bitmap_end) {
                 if (*bmp_it > 0) {
                     // encoded mode, repetition of same pixel value n-times
                     std::uint8_t n_rep{ *bmp_it++ };
-                    PixelT pxl_value{};
-                    bmpl::clr::convert(pxl_value, this->color_map[*bmp_it]);
-                    if (bmp_it != bitmap.cend())
-                        bmp_it++;
+                    std::uint8_t pxl_index{ 0 };
+                    if (bmp_it != bitmap_end)
+                        pxl_index = *bmp_it++;
+                    this->_palette.check_index(pxl_index);
+                    const PixelT pxl_value{ this->_palette[pxl_index] };
 
                     if (x + std::uint32_t(n_rep) > width) {
                         this->set_warning(bmpl::utils::WarningCode::DELTA_MODE_MAY_OVERFLOW);
@@ -944,16 +2111,15 @@ namespace bmpl
                     else
                         x += n_rep;
 
-                    while (n_rep--) {
-                        if (img_it == image_content.end()) {
-                            return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                        }
-                        *img_it++ = pxl_value;
+                    // notice: the run is validated once, then expanded at once
+                    if (!output.can_write(n_rep)) {
+                        return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
                     }
+                    output.fill(n_rep, pxl_value);
                 }
-                else if (bmp_it != bitmap.cend()) {
+                else if (bmp_it != bitmap_end) {
                     bmp_it++;
-                    if (bmp_it != bitmap.cend()) {
+                    if (bmp_it != bitmap_end) {
                         switch (*bmp_it++)
                         {
                         case 0:
@@ -963,13 +2129,16 @@ namespace bmpl
                             if (num_line == this->get_height()) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                             }
-                            img_it = image_content.begin() + std::size_t(num_line * width);
+                            if (!output.move_to(std::size_t(num_line) * std::size_t(width))) {
+                                // notice: streamed rows cannot be modified once they have been delivered
+                                return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                            }
                             break;
 
                         case 1:
                             // end of bitmap
                             encountered_eof = true;
-                            if (bmp_it != bitmap.cend()) {
+                            if (bmp_it != bitmap_end || remaining_size > 0) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                             }
                             break;
@@ -979,9 +2148,9 @@ namespace bmpl
                         {
                             std::uint8_t delta_pxls{ 0 };
                             std::uint8_t delta_lines{ 0 };
-                            if (bmp_it != bitmap.cend())
+                            if (bmp_it != bitmap_end)
                                 delta_pxls = *bmp_it++;
-                            if (bmp_it != bitmap.cend())
+                            if (bmp_it != bitmap_end)
                                 delta_lines = *bmp_it++;
 
                             if (x + std::uint32_t(delta_pxls) > width) {
@@ -991,12 +2160,13 @@ namespace bmpl
                             }
                             else
                                 x += delta_pxls;
+                            num_line += delta_lines;
 
                             const std::size_t offset{ std::size_t(delta_pxls) + width * std::size_t(delta_lines) };
-                            if ((img_it - image_content.begin()) + offset > width * std::size_t(this->get_height())) {
+                            if (output.get_index() + offset > width * std::size_t(this->get_height())) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_DELTA_MODE_VALUES);
                             }
-                            img_it += offset;
+                            output.move_to(output.get_index() + offset);
                         }
                         break;
 
@@ -1013,13 +2183,14 @@ namespace bmpl
                             else
                                 x += absolute_pixels_count;
 
-                            while (absolute_pixels_count-- && bmp_it != bitmap.cend()) {
-                                if (img_it == image_content.end()) {
-                                    return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                                }
-                                bmpl::clr::convert(*img_it++, this->color_map[*bmp_it++]);
+                            const std::size_t indices_count{ std::min(std::size_t(absolute_pixels_count), std::size_t(bitmap_end - bmp_it)) };
+                            if (!output.can_write(indices_count)) {
+                                return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
                             }
-                            if (padding && bmp_it != bitmap.cend())
+                            this->_palette.check_indices(bmp_it, indices_count);
+                            for (const auto indices_end = bmp_it + indices_count; bmp_it != indices_end; )
+                                output.next() = this->_palette[*bmp_it++];
+                            if (padding && bmp_it != bitmap_end)
                                 bmp_it++;
                             break;
                         }
@@ -1027,10 +2198,19 @@ namespace bmpl
                 }
             }
 
-            if (!encountered_eof) {
+            if (this->failed()) {
+                // some error happened while sliding the bitmap window
+                return false;
+            }
+
+            if (!encountered_eof && !output.is_done()) {
+                // notice: decoding of regions ends as soon as their last line is done
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
+            if (this->_palette.has_met_bad_indices())
+                this->set_warning(bmpl::utils::WarningCode::BAD_PALETTE_INDICES);
+
             this->append_warnings(this->color_map);
 
             // once here, everything was fine!
@@ -1040,115 +2220,76 @@ namespace bmpl
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader16bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader16bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
 
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t height{ std::size_t(this->get_height()) };
-            const std::size_t padding{ (width % 2) != 0 ? std::size_t(1) : std::size_t(0) };
-            const std::size_t line_width{ width + padding };
-            const std::size_t mask_size{ line_width * height };
-
-            const bmpl::bmpf::BitfieldMaskBase* red_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_red_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* green_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_green_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* blue_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_blue_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* alpha_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_alpha_mask()) };
-
-            std::vector<std::uint16_t> masked_content;
-            masked_content.assign(mask_size, std::uint16_t(0));
-
-            if (bmpl::utils::PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!(this->in_stream.read(reinterpret_cast<char*>(masked_content.data()), mask_size * sizeof(std::uint16_t)))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
-            }
-            else {
-                // big-endian underlying platform
-                for (auto& mask : masked_content) {
-                    if ((this->in_stream >> mask).failed()) {
-                        return this->_set_err(this->in_stream.get_error());
-                    }
-                }
-
+            line_size = std::size_t(this->get_width()) * sizeof(std::uint16_t);
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
+
+            // notice: pixels get decoded with a single lookup into the table of all the 16-bits values, or with the bitfields decoder if the table is not available
+            this->_table_ptr = bmpl::bmpf::get_bitfields16_table<PixelT>(
+                this->info_header_ptr->get_red_mask(),
+                this->info_header_ptr->get_green_mask(),
+                this->info_header_ptr->get_blue_mask(),
+                this->info_header_ptr->get_alpha_mask()
+            );
+            if (this->_table_ptr == nullptr) {
+                this->_bitfields_decoder.select(
+                    this->info_header_ptr->get_red_mask(),
+                    this->info_header_ptr->get_green_mask(),
+                    this->info_header_ptr->get_blue_mask(),
+                    this->info_header_ptr->get_alpha_mask(),
+                    sizeof(std::uint16_t)
+                );
             }
+            return true;
+        }
 
-            int line_pixels_count{ 0 };
-            auto mask_it{ masked_content.cbegin() };
-            for (auto& pixel : image_content) {
-                if (mask_it == masked_content.cend()) {
-                    this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-                    break;
-                }
-
-                const std::uint32_t mask_pxl_value{ *mask_it++ };
-
-                const std::uint32_t r{ red_mask_ptr->get_component_value(mask_pxl_value) };
-                const std::uint32_t g{ green_mask_ptr->get_component_value(mask_pxl_value) };
-                const std::uint32_t b{ blue_mask_ptr->get_component_value(mask_pxl_value) };
-                const std::uint32_t a{ alpha_mask_ptr->get_component_value(mask_pxl_value) };
-
-                bmpl::clr::set_pixel(pixel, r, g, b, a);
 
-                if (++line_pixels_count == width) {
-                    mask_it += padding;
-                    line_pixels_count = 0;
-                }
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader16bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            line_ptr += first_x * sizeof(std::uint16_t);
 
-            if (mask_it != masked_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
+            if (this->_table_ptr != nullptr) {
+                const PixelT* table_ptr{ this->_table_ptr->data() };
+                for (std::size_t x = 0; x < count; ++x, line_ptr += sizeof(std::uint16_t))
+                    *pixels_ptr++ = table_ptr[bmpl::utils::get_le_uint16(line_ptr)];
             }
-
-            // once here, everything was fine!
-            return this->_clr_err();
+            else
+                this->_bitfields_decoder.decode_line(line_ptr, pixels_ptr, count);
         }
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader24bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader24bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t height{ std::size_t(this->get_height()) };
-
-            // let's load the image content line after line
-            const std::size_t line_width{ width * 3 };
-            const std::size_t padding_size{ bmpl::bmpf::evaluate_padding(line_width) };
-
-            std::vector<bmpl::clr::BGR> bitmap_line;
-            bitmap_line.assign(width, bmpl::clr::BGR());
-
-            char* bitmap_line_ptr{ reinterpret_cast<char*>(bitmap_line.data()) };
-            auto img_it{ image_content.begin() };
-            for (int line = 0; line < height; ++line) {
-                if (!(this->in_stream.read(bitmap_line_ptr, line_width))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
+            line_size = std::size_t(this->get_width()) * 3;
+            line_stride = line_size + bmpl::bmpf::evaluate_padding(line_size);
 
-                for (auto& bitmap_pxl : bitmap_line)
-                    bmpl::clr::convert(*img_it++, bitmap_pxl);  // notice: no need of tests here on image content overflow
+            // notice: unpadded BGR lines are bit-identical to BGR image rows
+            this->_direct_copy = std::is_same<PixelT, bmpl::clr::BGR>::value && line_stride == line_size && sizeof(PixelT) == 3;
+            return true;
+        }
 
-                if (padding_size > 0 && (this->in_stream.seekg(padding_size, std::ios_base::cur)).fail()) {
-                    return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                }
-            }
 
-            // once here, everything was fine!
-            return this->_clr_err();
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader24bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            // notice: no need of tests here on image content overflow
+            bmpl::bmpf::convert_bgr_line(pixels_ptr, line_ptr + first_x * 3, count);
         }
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader24bitsRLE<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        template<typename OutputT>
+        const bool BitmapLoader24bitsRLE<PixelT>::_decode(OutputT& output) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
@@ -1157,16 +2298,13 @@ namespace bmpl
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
-            // loads the RLE-24 bitmap
-            const bmpl::utils::LEInStream::pos_type bitmap_size{ this->in_stream.get_size() - this->in_stream.tellg()};
-            std::vector<std::uint8_t> bitmap;
-            bitmap.assign(bitmap_size, std::uint8_t(0));
-            if (!(this->in_stream.read(reinterpret_cast<char*>(bitmap.data()), bitmap_size))) {
-                if (this->in_stream.eof())
-                    return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                else
-                    return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            }
+            // gets access to the RLE-24 bitmap
+            BytesBuffer buffer(this->_memory_resource_ptr);
+            const std::uint8_t* bitmap_ptr{ nullptr };
+            const std::uint8_t* bitmap_end{ nullptr };
+            std::size_t remaining_size{ 0 };
+            if (!this->_get_rle_window(bitmap_ptr, bitmap_end, buffer, remaining_size, false))
+                return false;
 
             // parses then the RLE-8 bitmap
             std::uint32_t width{ std::uint32_t(this->get_width()) };
@@ -1174,19 +2312,18 @@ namespace bmpl
             std::uint32_t x{ 0 };
             bool encountered_eof{ false };
 
-            auto img_it{ image_content.begin() };
-            auto bmp_it{ bitmap.cbegin() };
+            auto bmp_it{ bitmap_ptr };
 
-            while (bmp_it != bitmap.cend()) {
+            while (!output.is_done() && this->_slide_rle_window(bmp_it, bitmap_end, buffer, remaining_size) && bmp_it != bitmap_end) {
                 if (*bmp_it > 0) {
                     // encoded mode, repetition of same pixel value n-times
                     std::uint8_t n_rep{ *bmp_it++ };
                     PixelT pxl_value{};
-                    if (bmp_it != bitmap.cend())
+                    if (bmp_it != bitmap_end)
                         pxl_value.b = *bmp_it++;
-                    if (bmp_it != bitmap.cend())
+                    if (bmp_it != bitmap_end)
                         pxl_value.g = *bmp_it++;
-                    if (bmp_it != bitmap.cend())
+                    if (bmp_it != bitmap_end)
                         pxl_value.r = *bmp_it++;
 
                     if (x + std::uint32_t(n_rep) > width) {
@@ -1197,16 +2334,15 @@ namespace bmpl
                     else
                         x += n_rep;
 
-                    while (n_rep--) {
-                        if (img_it == image_content.end()) {
-                            return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
-                        }
-                        *img_it++ = pxl_value;
+                    // notice: the run is validated once, then expanded at once
+                    if (!output.can_write(n_rep)) {
+                        return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
                     }
+                    output.fill(n_rep, pxl_value);
                 }
-                else if (bmp_it != bitmap.cend()) {
+                else if (bmp_it != bitmap_end) {
                     bmp_it++;
-                    if (bmp_it != bitmap.cend()) {
+                    if (bmp_it != bitmap_end) {
                         switch (*bmp_it++)
                         {
                         case 0:
@@ -1216,13 +2352,16 @@ namespace bmpl
                             if (num_line == this->get_height()) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                             }
-                            img_it = image_content.begin() + std::size_t(num_line * width);
+                            if (!output.move_to(std::size_t(num_line) * std::size_t(width))) {
+                                // notice: streamed rows cannot be modified once they have been delivered
+                                return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
+                            }
                             break;
 
                         case 1:
                             // end of bitmap
                             encountered_eof = true;
-                            if (bmp_it != bitmap.cend()) {
+                            if (bmp_it != bitmap_end || remaining_size > 0) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
                             }
                             break;
@@ -1232,9 +2371,9 @@ namespace bmpl
                         {
                             std::uint8_t delta_pxls{ 0 };
                             std::uint8_t delta_lines{ 0 };
-                            if (bmp_it != bitmap.cend())
+                            if (bmp_it != bitmap_end)
                                 delta_pxls = *bmp_it++;
-                            if (bmp_it != bitmap.cend())
+                            if (bmp_it != bitmap_end)
                                 delta_lines = *bmp_it++;
 
                             if (x + std::uint32_t(delta_pxls) > width) {
@@ -1244,12 +2383,13 @@ namespace bmpl
                             }
                             else
                                 x += delta_pxls;
+                            num_line += delta_lines;
 
                             const std::size_t offset{ std::size_t(delta_pxls) + width * std::size_t(delta_lines) };
-                            if ((img_it - image_content.begin()) + offset > width * std::size_t(this->get_height())) {
+                            if (output.get_index() + offset > width * std::size_t(this->get_height())) {
                                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_DELTA_MODE_VALUES);
                             }
-                            img_it += offset;
+                            output.move_to(output.get_index() + offset);
                         }
                         break;
 
@@ -1266,21 +2406,21 @@ namespace bmpl
                             else
                                 x += absolute_pixels_count;
 
-                            while (absolute_pixels_count-- && bmp_it != bitmap.cend()) {
+                            while (absolute_pixels_count-- && bmp_it != bitmap_end) {
                                 PixelT pxl_value{};
-                                if (bmp_it != bitmap.cend())
+                                if (bmp_it != bitmap_end)
                                     pxl_value.b = *bmp_it++;
-                                if (bmp_it != bitmap.cend())
+                                if (bmp_it != bitmap_end)
                                     pxl_value.g = *bmp_it++;
-                                if (bmp_it != bitmap.cend())
+                                if (bmp_it != bitmap_end)
                                     pxl_value.r = *bmp_it++;
 
-                                if (img_it == image_content.end()) {
+                                if (output.is_full()) {
                                     return this->_set_err(bmpl::utils::ErrorCode::BUFFER_OVERFLOW);
                                 }
-                                *img_it++ = pxl_value;
+                                output.next() = pxl_value;
                             }
-                            if (padding && bmp_it != bitmap.cend())
+                            if (padding && bmp_it != bitmap_end)
                                 bmp_it++;
                             break;
                         }
@@ -1288,7 +2428,13 @@ namespace bmpl
                 }
             }
 
-            if (!encountered_eof) {
+            if (this->failed()) {
+                // some error happened while sliding the bitmap window
+                return false;
+            }
+
+            if (!encountered_eof && !output.is_done()) {
+                // notice: decoding of regions ends as soon as their last line is done
                 return this->_set_err(bmpl::utils::ErrorCode::INCOHERENT_RUN_LENGTH_ENCODING);
             }
 
@@ -1301,116 +2447,87 @@ namespace bmpl
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader32bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader32bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
             if (this->info_header_ptr == nullptr)
                 return this->_set_err(bmpl::utils::ErrorCode::BAD_INFO_HEADER);
 
-            const std::size_t width{ std::size_t(this->get_width()) };
-            const std::size_t height{ std::size_t(this->get_height()) };
-            const std::size_t mask_size{ width * height };
+            // notice: 32-bits lines never get padded
+            line_size = line_stride = std::size_t(this->get_width()) * sizeof(std::uint32_t);
+
+            this->_bitfields_decoder.select(
+                this->info_header_ptr->get_red_mask(),
+                this->info_header_ptr->get_green_mask(),
+                this->info_header_ptr->get_blue_mask(),
+                this->info_header_ptr->get_alpha_mask(),
+                sizeof(std::uint32_t)
+            );
+
+            // notice: with default masks, BGRA pixels are bit-identical to their bitmap encoding, with no alpha when its mask is not set
+            const bool default_masks{
+                this->info_header_ptr->get_red_mask() == 0x00ff'0000 &&
+                this->info_header_ptr->get_green_mask() == 0x0000'ff00 &&
+                this->info_header_ptr->get_blue_mask() == 0x0000'00ff &&
+                (this->info_header_ptr->get_alpha_mask() == 0xff00'0000 || this->info_header_ptr->get_alpha_mask() == 0)
+            };
+            this->_direct_copy = std::is_same<PixelT, bmpl::clr::BGRA>::value && default_masks && sizeof(PixelT) == 4;
+            this->_zero_alpha = this->info_header_ptr->get_alpha_mask() == 0;
+            return true;
+        }
 
-            const bmpl::bmpf::BitfieldMaskBase* red_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_red_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* green_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_green_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* blue_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_blue_mask()) };
-            const bmpl::bmpf::BitfieldMaskBase* alpha_mask_ptr{ bmpl::bmpf::create_bitfield_mask(this->info_header_ptr->get_alpha_mask()) };
 
-            std::vector<std::uint32_t> masked_content;
-            masked_content.assign(mask_size, std::uint32_t(0));
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader32bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            line_ptr += first_x * sizeof(std::uint32_t);
 
-            if (bmpl::utils::PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!(this->in_stream.read(reinterpret_cast<char*>(masked_content.data()), mask_size * sizeof(std::uint32_t)))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
-            }
-            else {
-                // big-endian underlying platform
-                for (auto& mask : masked_content) {
-                    if ((this->in_stream >> mask).failed()) {
-                        return this->_set_err(this->in_stream.get_error());
-                    }
-                }
+            if (this->_direct_copy) {
+                std::memcpy(pixels_ptr, line_ptr, count * sizeof(PixelT));
+                this->_fix_up_direct_pixels(pixels_ptr, count);
             }
+            else
+                this->_bitfields_decoder.decode_line(line_ptr, pixels_ptr, count);
+        }
 
-            auto mask_it{ masked_content.cbegin() };
-            for (auto& pixel : image_content) {
-                if (mask_it == masked_content.cend()) {
-                    this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-                    break;
-                }
-
-                const std::uint32_t mask_pxl_value{ *mask_it++ };
-
-                bmpl::clr::set_pixel(
-                    pixel,
-                    red_mask_ptr->get_component_value(mask_pxl_value),
-                    green_mask_ptr->get_component_value(mask_pxl_value),
-                    blue_mask_ptr->get_component_value(mask_pxl_value),
-                    alpha_mask_ptr->get_component_value(mask_pxl_value)
-                );
-            }
 
-            if (mask_it != masked_content.cend()) {
-                this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader32bits<PixelT>::_fix_up_direct_pixels(PixelT* pixels_ptr, const std::size_t pixels_count) noexcept
+        {
+            // notice: directly copied pixels are BGRA ones, with bytes of alpha components at offset 3
+            if (this->_zero_alpha) {
+                std::uint8_t* bytes_ptr{ reinterpret_cast<std::uint8_t*>(pixels_ptr) };
+                for (std::size_t i = 0; i < pixels_count; ++i)
+                    bytes_ptr[4 * i + 3] = 0;
             }
-
-            // once here, everything was fine!
-            return this->_clr_err();
         }
 
 
         //===========================================================================
         template<typename PixelT>
-        const bool BitmapLoader64bits<PixelT>::load(std::vector<PixelT>& image_content) noexcept
+        const bool BitmapLoader64bits<PixelT>::_prepare_lines(std::size_t& line_size, std::size_t& line_stride) noexcept
         {
-            const std::size_t bmp_size{ std::size_t(this->get_width()) * std::size_t(this->get_height()) };
-
-            std::vector<bmpl::clr::BGRA_HDR> bitmap;
-            bitmap.assign(bmp_size, bmpl::clr::BGRA_HDR());
-
-            if (bmpl::utils::PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!(this->in_stream.read(reinterpret_cast<char*>(bitmap.data()), bmp_size * sizeof(bmpl::clr::BGRA_HDR)))) {
-                    if (this->in_stream.eof())
-                        return this->_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
-                    else
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                }
-            }
-            else {
-                for (auto bmp_it = bitmap.begin(); bmp_it != bitmap.end(); ++bmp_it) {
-                    if ((this->in_stream >> bmp_it->b).failed()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
-                    if ((this->in_stream >> bmp_it->g).failed()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
-                    if ((this->in_stream >> bmp_it->r).failed()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
-                    if ((this->in_stream >> bmp_it->a).failed()) {
-                        return this->_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-                    }
-                }
-            }
-
-            auto img_it = image_content.begin();
-            for (const auto& bitmap_pxl : bitmap) {
-                if (img_it == image_content.end()) {
-                    this->set_warning(bmpl::utils::WarningCode::TOO_MANY_INDICES_IN_BITMAP);
-                    break;
-                }
-                bmpl::clr::convert(*img_it++, bitmap_pxl);
+            // notice: 64-bits lines never get padded
+            line_size = line_stride = std::size_t(this->get_width()) * sizeof(bmpl::clr::BGRA_HDR);
+
+            if (this->_tone_mapping) {
+                // HDR images get decalibrated to be shown on displays, with gamma evaluated once per 8-bits level of components
+                constexpr double gamma{ double(1.0 / 2.2) };  // notice: 2.2 is a very common value that suits most cases
+                constexpr double coeff{ 255.0 };
+                for (std::uint32_t level = 0; level < 256; ++level)
+                    this->_tone_levels[level] = std::uint8_t(coeff * std::pow(level / coeff, gamma));
             }
+            return true;
+        }
 
-            if (img_it != image_content.end()) {
-                this->set_warning(bmpl::utils::WarningCode::NOT_ENOUGH_INDICES_IN_BITMAP);
-            }
 
-            // once here, everything was fine!
-            return this->_clr_err();
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BitmapLoader64bits<PixelT>::_decode_line(const std::uint8_t* line_ptr, PixelT* pixels_ptr, const std::size_t first_x, const std::size_t count) noexcept
+        {
+            // notice: clamping, tone mapping and storing are fused in one pass over each line
+            bmpl::bmpf::convert_hdr_line(pixels_ptr, line_ptr + first_x * sizeof(bmpl::clr::BGRA_HDR), count, this->_tone_mapping ? this->_tone_levels.data() : nullptr);
         }
     }
 }
\ No newline at end of file
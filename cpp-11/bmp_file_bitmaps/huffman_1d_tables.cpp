@@ -0,0 +1,163 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include "huffman_1d_tables.h"
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        // The CCITT T.4 codes, as { code value, code bits count, run length }
+        struct _HuffmanCodeDef
+        {
+            std::uint16_t code;
+            std::uint8_t  bits_count;
+            std::uint16_t run_length;
+        };
+
+        // white runs of 0 up to 63 pixels
+        static const _HuffmanCodeDef _WHITE_TERMINATING_CODES[]{
+            { 0x0035,  8,    0 }, { 0x0007,  6,    1 }, { 0x0007,  4,    2 }, { 0x0008,  4,    3 },
+            { 0x000b,  4,    4 }, { 0x000c,  4,    5 }, { 0x000e,  4,    6 }, { 0x000f,  4,    7 },
+            { 0x0013,  5,    8 }, { 0x0014,  5,    9 }, { 0x0007,  5,   10 }, { 0x0008,  5,   11 },
+            { 0x0008,  6,   12 }, { 0x0003,  6,   13 }, { 0x0034,  6,   14 }, { 0x0035,  6,   15 },
+            { 0x002a,  6,   16 }, { 0x002b,  6,   17 }, { 0x0027,  7,   18 }, { 0x000c,  7,   19 },
+            { 0x0008,  7,   20 }, { 0x0017,  7,   21 }, { 0x0003,  7,   22 }, { 0x0004,  7,   23 },
+            { 0x0028,  7,   24 }, { 0x002b,  7,   25 }, { 0x0013,  7,   26 }, { 0x0024,  7,   27 },
+            { 0x0018,  7,   28 }, { 0x0002,  8,   29 }, { 0x0003,  8,   30 }, { 0x001a,  8,   31 },
+            { 0x001b,  8,   32 }, { 0x0012,  8,   33 }, { 0x0013,  8,   34 }, { 0x0014,  8,   35 },
+            { 0x0015,  8,   36 }, { 0x0016,  8,   37 }, { 0x0017,  8,   38 }, { 0x0028,  8,   39 },
+            { 0x0029,  8,   40 }, { 0x002a,  8,   41 }, { 0x002b,  8,   42 }, { 0x002c,  8,   43 },
+            { 0x002d,  8,   44 }, { 0x0004,  8,   45 }, { 0x0005,  8,   46 }, { 0x000a,  8,   47 },
+            { 0x000b,  8,   48 }, { 0x0052,  8,   49 }, { 0x0053,  8,   50 }, { 0x0054,  8,   51 },
+            { 0x0055,  8,   52 }, { 0x0024,  8,   53 }, { 0x0025,  8,   54 }, { 0x0058,  8,   55 },
+            { 0x0059,  8,   56 }, { 0x005a,  8,   57 }, { 0x005b,  8,   58 }, { 0x004a,  8,   59 },
+            { 0x004b,  8,   60 }, { 0x0032,  8,   61 }, { 0x0033,  8,   62 }, { 0x0034,  8,   63 },
+        };
+
+        // white runs of 64 up to 1728 pixels
+        static const _HuffmanCodeDef _WHITE_MAKEUP_CODES[]{
+            { 0x001b,  5,   64 }, { 0x0012,  5,  128 }, { 0x0017,  6,  192 }, { 0x0037,  7,  256 },
+            { 0x0036,  8,  320 }, { 0x0037,  8,  384 }, { 0x0064,  8,  448 }, { 0x0065,  8,  512 },
+            { 0x0068,  8,  576 }, { 0x0067,  8,  640 }, { 0x00cc,  9,  704 }, { 0x00cd,  9,  768 },
+            { 0x00d2,  9,  832 }, { 0x00d3,  9,  896 }, { 0x00d4,  9,  960 }, { 0x00d5,  9, 1024 },
+            { 0x00d6,  9, 1088 }, { 0x00d7,  9, 1152 }, { 0x00d8,  9, 1216 }, { 0x00d9,  9, 1280 },
+            { 0x00da,  9, 1344 }, { 0x00db,  9, 1408 }, { 0x0098,  9, 1472 }, { 0x0099,  9, 1536 },
+            { 0x009a,  9, 1600 }, { 0x0018,  6, 1664 }, { 0x009b,  9, 1728 },
+        };
+
+        // black runs of 0 up to 63 pixels
+        static const _HuffmanCodeDef _BLACK_TERMINATING_CODES[]{
+            { 0x0037, 10,    0 }, { 0x0002,  3,    1 }, { 0x0003,  2,    2 }, { 0x0002,  2,    3 },
+            { 0x0003,  3,    4 }, { 0x0003,  4,    5 }, { 0x0002,  4,    6 }, { 0x0003,  5,    7 },
+            { 0x0005,  6,    8 }, { 0x0004,  6,    9 }, { 0x0004,  7,   10 }, { 0x0005,  7,   11 },
+            { 0x0007,  7,   12 }, { 0x0004,  8,   13 }, { 0x0007,  8,   14 }, { 0x0018,  9,   15 },
+            { 0x0017, 10,   16 }, { 0x0018, 10,   17 }, { 0x0008, 10,   18 }, { 0x0067, 11,   19 },
+            { 0x0068, 11,   20 }, { 0x006c, 11,   21 }, { 0x0037, 11,   22 }, { 0x0028, 11,   23 },
+            { 0x0017, 11,   24 }, { 0x0018, 11,   25 }, { 0x00ca, 12,   26 }, { 0x00cb, 12,   27 },
+            { 0x00cc, 12,   28 }, { 0x00cd, 12,   29 }, { 0x0068, 12,   30 }, { 0x0069, 12,   31 },
+            { 0x006a, 12,   32 }, { 0x006b, 12,   33 }, { 0x00d2, 12,   34 }, { 0x00d3, 12,   35 },
+            { 0x00d4, 12,   36 }, { 0x00d5, 12,   37 }, { 0x00d6, 12,   38 }, { 0x00d7, 12,   39 },
+            { 0x006c, 12,   40 }, { 0x006d, 12,   41 }, { 0x00da, 12,   42 }, { 0x00db, 12,   43 },
+            { 0x0054, 12,   44 }, { 0x0055, 12,   45 }, { 0x0056, 12,   46 }, { 0x0057, 12,   47 },
+            { 0x0064, 12,   48 }, { 0x0065, 12,   49 }, { 0x0052, 12,   50 }, { 0x0053, 12,   51 },
+            { 0x0024, 12,   52 }, { 0x0037, 12,   53 }, { 0x0038, 12,   54 }, { 0x0027, 12,   55 },
+            { 0x0028, 12,   56 }, { 0x0058, 12,   57 }, { 0x0059, 12,   58 }, { 0x002b, 12,   59 },
+            { 0x002c, 12,   60 }, { 0x005a, 12,   61 }, { 0x0066, 12,   62 }, { 0x0067, 12,   63 },
+        };
+
+        // black runs of 64 up to 1728 pixels
+        static const _HuffmanCodeDef _BLACK_MAKEUP_CODES[]{
+            { 0x000f, 10,   64 }, { 0x00c8, 12,  128 }, { 0x00c9, 12,  192 }, { 0x005b, 12,  256 },
+            { 0x0033, 12,  320 }, { 0x0034, 12,  384 }, { 0x0035, 12,  448 }, { 0x006c, 13,  512 },
+            { 0x006d, 13,  576 }, { 0x004a, 13,  640 }, { 0x004b, 13,  704 }, { 0x004c, 13,  768 },
+            { 0x004d, 13,  832 }, { 0x0072, 13,  896 }, { 0x0073, 13,  960 }, { 0x0074, 13, 1024 },
+            { 0x0075, 13, 1088 }, { 0x0076, 13, 1152 }, { 0x0077, 13, 1216 }, { 0x0052, 13, 1280 },
+            { 0x0053, 13, 1344 }, { 0x0054, 13, 1408 }, { 0x0055, 13, 1472 }, { 0x005a, 13, 1536 },
+            { 0x005b, 13, 1600 }, { 0x0064, 13, 1664 }, { 0x0065, 13, 1728 },
+        };
+
+        // runs of 1792 up to 2560 pixels, for both colors
+        static const _HuffmanCodeDef _EXTENDED_MAKEUP_CODES[]{
+            { 0x0008, 11, 1792 }, { 0x000c, 11, 1856 }, { 0x000d, 11, 1920 }, { 0x0012, 12, 1984 },
+            { 0x0013, 12, 2048 }, { 0x0014, 12, 2112 }, { 0x0015, 12, 2176 }, { 0x0016, 12, 2240 },
+            { 0x0017, 12, 2304 }, { 0x001c, 12, 2368 }, { 0x001d, 12, 2432 }, { 0x001e, 12, 2496 },
+            { 0x001f, 12, 2560 },
+        };
+
+
+        //---------------------------------------------------------------------------
+        template<std::size_t N>
+        static void _fill_lookup_table(Huffman1DTables::LookupTable& table, const _HuffmanCodeDef (&codes)[N]) noexcept
+        {
+            // each code fills all the entries which indices start with its bits
+            for (const _HuffmanCodeDef& code_def : codes) {
+                const std::uint32_t free_bits_count{ HUFFMAN_1D_LOOKUP_BITS - code_def.bits_count };
+                const std::uint32_t first_index{ std::uint32_t(code_def.code) << free_bits_count };
+                const std::uint32_t last_index{ first_index + (std::uint32_t(1) << free_bits_count) };
+                for (std::uint32_t index = first_index; index < last_index; ++index) {
+                    table[index].run_length = code_def.run_length;
+                    table[index].bits_count = code_def.bits_count;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------------
+        static const Huffman1DTables _build_huffman_1d_tables() noexcept
+        {
+            Huffman1DTables tables;
+
+            _fill_lookup_table(tables.white, _WHITE_TERMINATING_CODES);
+            _fill_lookup_table(tables.white, _WHITE_MAKEUP_CODES);
+            _fill_lookup_table(tables.white, _EXTENDED_MAKEUP_CODES);
+
+            _fill_lookup_table(tables.black, _BLACK_TERMINATING_CODES);
+            _fill_lookup_table(tables.black, _BLACK_MAKEUP_CODES);
+            _fill_lookup_table(tables.black, _EXTENDED_MAKEUP_CODES);
+
+            return tables;
+        }
+
+
+        //===========================================================================
+        //  get_huffman_1d_tables()
+        //---------------------------------------------------------------------------
+        const Huffman1DTables& get_huffman_1d_tables() noexcept
+        {
+            // notice: thread-safe initialization of local statics is guaranteed since c++11
+            static const Huffman1DTables tables{ _build_huffman_1d_tables() };
+            return tables;
+        }
+
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        // One entry of the Huffman-1D lookup tables - run_length is the count of pixels
+        // of a terminating code (less than 64) or of a makeup code (a multiple of 64),
+        // bits_count is the length of the code, 0 for not valid codes
+        struct Huffman1DCode
+        {
+            std::uint16_t run_length{ 0 };
+            std::uint8_t  bits_count{ 0 };
+        };
+
+
+        //===========================================================================
+        // The CCITT T.4 Modified Huffman codes of white and black runs, indexed by the
+        // next HUFFMAN_1D_LOOKUP_BITS bits of the encoded bitmap - each code gets decoded
+        // with a single lookup since no code is longer than 13 bits.
+        // notice: End Of Line codes and their fill bits are not part of these tables; they
+        // are the only codes that start with 8 zero bits.
+        static constexpr std::uint32_t HUFFMAN_1D_LOOKUP_BITS{ 13 };
+
+        struct Huffman1DTables
+        {
+            using LookupTable = std::array<Huffman1DCode, std::size_t(1) << HUFFMAN_1D_LOOKUP_BITS>;
+
+            LookupTable white{};
+            LookupTable black{};
+        };
+
+
+        //===========================================================================
+        // Returns the lookup tables, evaluated once at first call.
+        const Huffman1DTables& get_huffman_1d_tables() noexcept;
+
+    }
+}
@@ -0,0 +1,401 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define BMPL_X86_SIMD
+#endif
+
+#include "lines_conversions.h"
+#include "../utils/cpu_features.h"
+
+
+#if defined(BMPL_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define BMPL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define BMPL_TARGET_AVX2  __attribute__((target("avx2")))
+#else
+#define BMPL_TARGET_SSSE3
+#define BMPL_TARGET_AVX2
+#endif
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        //  Local kernels - each one converts as many pixels as it can and returns their count, the remaining ones are converted by the scalar code
+        //---------------------------------------------------------------------------
+        using BGRLineKernel = const std::size_t(*)(std::uint8_t*, const std::uint8_t*, const std::size_t);
+        using PaletteLineKernel = const std::size_t(*)(std::uint32_t*, const std::uint32_t*, const std::uint8_t*, const std::size_t);
+        using HDRLineKernel = BGRLineKernel;
+
+
+#if defined(BMPL_X86_SIMD)
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static inline const std::size_t _bgr_to_quads_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width, const __m128i shuffle_mask) noexcept
+        {
+            // notice: 16 pixels, i.e. 48 bytes, are expanded per loop
+            std::size_t x{ 0 };
+            for (; x + 16 <= width; x += 16, src_ptr += 48, dst_ptr += 64) {
+                const __m128i bytes_0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+                const __m128i bytes_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 16));
+                const __m128i bytes_2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 32));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_shuffle_epi8(bytes_0, shuffle_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 16), _mm_shuffle_epi8(_mm_alignr_epi8(bytes_1, bytes_0, 12), shuffle_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 32), _mm_shuffle_epi8(_mm_alignr_epi8(bytes_2, bytes_1, 8), shuffle_mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 48), _mm_shuffle_epi8(_mm_srli_si128(bytes_2, 4), shuffle_mask));
+            }
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_AVX2
+        static inline const std::size_t _bgr_to_quads_avx2(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width, const __m256i shuffle_mask) noexcept
+        {
+            // notice: 16 pixels are expanded per loop, 4 of them per 128-bits lane; the last load reads 4 bytes past the 48 converted ones, hence the 18 pixels condition
+            std::size_t x{ 0 };
+            for (; x + 18 <= width; x += 16, src_ptr += 48, dst_ptr += 64) {
+                const __m256i bytes_0 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 12)),
+                    1
+                );
+                const __m256i bytes_1 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 24))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 36)),
+                    1
+                );
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_ptr), _mm256_shuffle_epi8(bytes_0, shuffle_mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_ptr + 32), _mm256_shuffle_epi8(bytes_1, shuffle_mask));
+            }
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _bgr_to_bgra_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            // notice: alpha bytes are zeroed, as with the scalar conversion
+            return _bgr_to_quads_ssse3(dst_ptr, src_ptr, width, _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128));
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _bgr_to_rgba_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            return _bgr_to_quads_ssse3(dst_ptr, src_ptr, width, _mm_setr_epi8(2, 1, 0, -128, 5, 4, 3, -128, 8, 7, 6, -128, 11, 10, 9, -128));
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_AVX2
+        static const std::size_t _bgr_to_bgra_avx2(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            return _bgr_to_quads_avx2(dst_ptr, src_ptr, width, _mm256_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128,
+                                                                                0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128));
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_AVX2
+        static const std::size_t _bgr_to_rgba_avx2(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            return _bgr_to_quads_avx2(dst_ptr, src_ptr, width, _mm256_setr_epi8(2, 1, 0, -128, 5, 4, 3, -128, 8, 7, 6, -128, 11, 10, 9, -128,
+                                                                                2, 1, 0, -128, 5, 4, 3, -128, 8, 7, 6, -128, 11, 10, 9, -128));
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _bgr_to_rgb_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            // notice: 5 pixels are swapped per loop; the 16th loaded and stored byte belongs to the next pixel, which is rewritten next loop, hence the 6 pixels condition
+            const __m128i shuffle_mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+            std::size_t x{ 0 };
+            for (; x + 6 <= width; x += 5, src_ptr += 15, dst_ptr += 15)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr)), shuffle_mask));
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_AVX2
+        static const std::size_t _gather_quads_avx2(std::uint32_t* dst_ptr, const std::uint32_t* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+        {
+            // notice: 8 pixels are gathered per loop, their 8-bits indices being zero-extended to 32-bits ones
+            std::size_t x{ 0 };
+            for (; x + 8 <= count; x += 8, indices_ptr += 8, dst_ptr += 8) {
+                const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices_ptr)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_ptr), _mm256_i32gather_epi32(reinterpret_cast<const int*>(palette_ptr), indices, 4));
+            }
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static inline const __m128i _hdr_to_bytes_ssse3(const std::uint8_t* src_ptr) noexcept
+        {
+            // notice: components are clamped to 8191, i.e. 1.0 in s2.13 fixed-point and negative ones included, with no branch
+            // (v - saturated(v - 8191) == min(v, 8191)), then get their 8 upper bits; 4 pixels are converted at once
+            const __m128i max_value = _mm_set1_epi16(8191);
+            __m128i words_0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+            __m128i words_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + 16));
+            words_0 = _mm_srli_epi16(_mm_sub_epi16(words_0, _mm_subs_epu16(words_0, max_value)), 5);
+            words_1 = _mm_srli_epi16(_mm_sub_epi16(words_1, _mm_subs_epu16(words_1, max_value)), 5);
+            return _mm_packus_epi16(words_0, words_1);
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _hdr_to_bgra_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            std::size_t x{ 0 };
+            for (; x + 4 <= width; x += 4, src_ptr += 32, dst_ptr += 16)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _hdr_to_bytes_ssse3(src_ptr));
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _hdr_to_rgba_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            const __m128i shuffle_mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+            std::size_t x{ 0 };
+            for (; x + 4 <= width; x += 4, src_ptr += 32, dst_ptr += 16)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_shuffle_epi8(_hdr_to_bytes_ssse3(src_ptr), shuffle_mask));
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static inline const std::size_t _hdr_to_triplets_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width, const __m128i shuffle_mask) noexcept
+        {
+            // notice: 4 pixels, i.e. 12 bytes, are stored per loop; the 4 last stored bytes belong to the next pixels, which are rewritten next loop, hence the 6 pixels condition
+            std::size_t x{ 0 };
+            for (; x + 6 <= width; x += 4, src_ptr += 32, dst_ptr += 12)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_shuffle_epi8(_hdr_to_bytes_ssse3(src_ptr), shuffle_mask));
+            return x;
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _hdr_to_bgr_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            return _hdr_to_triplets_ssse3(dst_ptr, src_ptr, width, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128));
+        }
+
+        //---------------------------------------------------------------------------
+        BMPL_TARGET_SSSE3
+        static const std::size_t _hdr_to_rgb_ssse3(std::uint8_t* dst_ptr, const std::uint8_t* src_ptr, const std::size_t width) noexcept
+        {
+            return _hdr_to_triplets_ssse3(dst_ptr, src_ptr, width, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -128, -128, -128, -128));
+        }
+
+#endif
+
+
+        //---------------------------------------------------------------------------
+        static const BGRLineKernel _select_kernel(const BGRLineKernel ssse3_kernel, const BGRLineKernel avx2_kernel) noexcept
+        {
+            const bmpl::utils::CPUFeatures& cpu_features{ bmpl::utils::get_cpu_features() };
+            if (cpu_features.avx2 && avx2_kernel != nullptr)
+                return avx2_kernel;
+            else if (cpu_features.ssse3)
+                return ssse3_kernel;
+            else
+                return nullptr;
+        }
+
+
+        //===========================================================================
+        //  convert_bgr_line()
+        //---------------------------------------------------------------------------
+        void convert_bgr_line(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const BGRLineKernel kernel{ _select_kernel(_bgr_to_bgra_ssse3, _bgr_to_bgra_avx2) };
+            if (kernel != nullptr) {
+                const std::size_t converted_count{ kernel(reinterpret_cast<std::uint8_t*>(pixels_ptr), line_ptr, width) };
+                pixels_ptr += converted_count;
+                line_ptr += 3 * converted_count;
+                convert_bgr_line<bmpl::clr::BGRA>(pixels_ptr, line_ptr, width - converted_count);
+                return;
+            }
+#endif
+            convert_bgr_line<bmpl::clr::BGRA>(pixels_ptr, line_ptr, width);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_bgr_line(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const BGRLineKernel kernel{ _select_kernel(_bgr_to_rgba_ssse3, _bgr_to_rgba_avx2) };
+            if (kernel != nullptr) {
+                const std::size_t converted_count{ kernel(reinterpret_cast<std::uint8_t*>(pixels_ptr), line_ptr, width) };
+                pixels_ptr += converted_count;
+                line_ptr += 3 * converted_count;
+                convert_bgr_line<bmpl::clr::RGBA>(pixels_ptr, line_ptr, width - converted_count);
+                return;
+            }
+#endif
+            convert_bgr_line<bmpl::clr::RGBA>(pixels_ptr, line_ptr, width);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_bgr_line(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept
+        {
+            // notice: same layout in file and in memory, so just a copy of bytes
+            std::memcpy(pixels_ptr, line_ptr, 3 * width);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_bgr_line(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            // notice: no AVX2 kernel there, since 3-bytes pixels do not fit the 128-bits lanes of 256-bits shuffles
+            static const BGRLineKernel kernel{ _select_kernel(_bgr_to_rgb_ssse3, nullptr) };
+            if (kernel != nullptr) {
+                const std::size_t converted_count{ kernel(reinterpret_cast<std::uint8_t*>(pixels_ptr), line_ptr, width) };
+                pixels_ptr += converted_count;
+                line_ptr += 3 * converted_count;
+                convert_bgr_line<bmpl::clr::RGB>(pixels_ptr, line_ptr, width - converted_count);
+                return;
+            }
+#endif
+            convert_bgr_line<bmpl::clr::RGB>(pixels_ptr, line_ptr, width);
+        }
+
+
+        //===========================================================================
+        //  gather_palette_line()
+        //---------------------------------------------------------------------------
+        static const PaletteLineKernel _select_palette_kernel() noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            if (bmpl::utils::get_cpu_features().avx2)
+                return _gather_quads_avx2;
+#endif
+            return nullptr;
+        }
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        static inline void _gather_quads_line(PixelT* pixels_ptr, const PixelT* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+        {
+            static const PaletteLineKernel kernel{ _select_palette_kernel() };
+            if (kernel != nullptr) {
+                const std::size_t gathered_count{ kernel(reinterpret_cast<std::uint32_t*>(pixels_ptr), reinterpret_cast<const std::uint32_t*>(palette_ptr), indices_ptr, count) };
+                gather_palette_line<PixelT>(pixels_ptr + gathered_count, palette_ptr, indices_ptr + gathered_count, count - gathered_count);
+            }
+            else
+                gather_palette_line<PixelT>(pixels_ptr, palette_ptr, indices_ptr, count);
+        }
+
+        //---------------------------------------------------------------------------
+        void gather_palette_line(bmpl::clr::BGRA* pixels_ptr, const bmpl::clr::BGRA* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+        {
+            _gather_quads_line(pixels_ptr, palette_ptr, indices_ptr, count);
+        }
+
+        //---------------------------------------------------------------------------
+        void gather_palette_line(bmpl::clr::RGBA* pixels_ptr, const bmpl::clr::RGBA* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+        {
+            _gather_quads_line(pixels_ptr, palette_ptr, indices_ptr, count);
+        }
+
+
+
+        //===========================================================================
+        //  convert_hdr_line()
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        static inline void _convert_hdr_line(PixelT* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr, const HDRLineKernel kernel) noexcept
+        {
+            // notice: tone mapping, if any, is applied to the pixels converted by the SIMD kernel while they are still hot in cache
+            if (kernel != nullptr) {
+                const std::size_t converted_count{ kernel(reinterpret_cast<std::uint8_t*>(pixels_ptr), line_ptr, width) };
+                if (levels_ptr != nullptr)
+                    tone_map_pixels(pixels_ptr, converted_count, levels_ptr);
+                convert_hdr_line<PixelT>(pixels_ptr + converted_count, line_ptr + sizeof(bmpl::clr::BGRA_HDR) * converted_count, width - converted_count, levels_ptr);
+            }
+            else
+                convert_hdr_line<PixelT>(pixels_ptr, line_ptr, width, levels_ptr);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_hdr_line(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const HDRLineKernel kernel{ _select_kernel(_hdr_to_bgra_ssse3, nullptr) };
+#else
+            constexpr HDRLineKernel kernel{ nullptr };
+#endif
+            _convert_hdr_line(pixels_ptr, line_ptr, width, levels_ptr, kernel);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_hdr_line(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const HDRLineKernel kernel{ _select_kernel(_hdr_to_rgba_ssse3, nullptr) };
+#else
+            constexpr HDRLineKernel kernel{ nullptr };
+#endif
+            _convert_hdr_line(pixels_ptr, line_ptr, width, levels_ptr, kernel);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_hdr_line(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const HDRLineKernel kernel{ _select_kernel(_hdr_to_bgr_ssse3, nullptr) };
+#else
+            constexpr HDRLineKernel kernel{ nullptr };
+#endif
+            _convert_hdr_line(pixels_ptr, line_ptr, width, levels_ptr, kernel);
+        }
+
+        //---------------------------------------------------------------------------
+        void convert_hdr_line(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept
+        {
+#if defined(BMPL_X86_SIMD)
+            static const HDRLineKernel kernel{ _select_kernel(_hdr_to_rgb_ssse3, nullptr) };
+#else
+            constexpr HDRLineKernel kernel{ nullptr };
+#endif
+            _convert_hdr_line(pixels_ptr, line_ptr, width, levels_ptr, kernel);
+        }
+
+    }
+
+}
\ No newline at end of file
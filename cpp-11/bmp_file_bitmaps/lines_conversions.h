@@ -0,0 +1,118 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../utils/colors.h"
+
+
+namespace bmpl
+{
+    namespace bmpf
+    {
+        //===========================================================================
+        // Converts a line of BMP-encoded 24-bits pixels into a line of pixels of the final image
+        template<typename PixelT>
+        inline void convert_bgr_line(PixelT* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept
+        {
+            // notice: scalar conversion, used for any pixel type that gets no specialized conversion
+            const bmpl::clr::BGR* bgr_ptr{ reinterpret_cast<const bmpl::clr::BGR*>(line_ptr) };
+            for (std::size_t x = 0; x < width; ++x)
+                bmpl::clr::convert(*pixels_ptr++, *bgr_ptr++);
+        }
+
+        // notice: next conversions use SIMD kernels when available on the running CPU, selected once at first call
+        void convert_bgr_line(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept;
+        void convert_bgr_line(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept;
+        void convert_bgr_line(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept;
+        void convert_bgr_line(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width) noexcept;
+
+
+        //===========================================================================
+        // Tone maps the color components of pixels through a table of the 256 final levels of components
+        template<typename PixelT>
+        inline void tone_map_pixels(PixelT* pixels_ptr, const std::size_t count, const std::uint8_t* levels_ptr) noexcept
+        {
+            // notice: alpha components, if any, are not tone mapped
+            for (std::size_t x = 0; x < count; ++x, ++pixels_ptr) {
+                pixels_ptr->r = levels_ptr[pixels_ptr->r];
+                pixels_ptr->g = levels_ptr[pixels_ptr->g];
+                pixels_ptr->b = levels_ptr[pixels_ptr->b];
+            }
+        }
+
+
+        //===========================================================================
+        // Converts a line of BMP-encoded 64-bits HDR pixels, with s2.13 fixed-point components, into a line of pixels of
+        // the final image - components are clamped to 1.0 then get 8 bits, and are tone mapped when levels_ptr is not null
+        template<typename PixelT>
+        inline void convert_hdr_line(PixelT* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept
+        {
+            // notice: scalar conversion, used for any pixel type that gets no specialized conversion
+            for (std::size_t x = 0; x < width; ++x, line_ptr += sizeof(bmpl::clr::BGRA_HDR)) {
+                bmpl::clr::BGRA_HDR bitmap_pxl;
+                bitmap_pxl.b = std::uint16_t(line_ptr[0] | (line_ptr[1] << 8));
+                bitmap_pxl.g = std::uint16_t(line_ptr[2] | (line_ptr[3] << 8));
+                bitmap_pxl.r = std::uint16_t(line_ptr[4] | (line_ptr[5] << 8));
+                bitmap_pxl.a = std::uint16_t(line_ptr[6] | (line_ptr[7] << 8));
+                bmpl::clr::convert(pixels_ptr[x], bitmap_pxl);
+            }
+            if (levels_ptr != nullptr)
+                tone_map_pixels(pixels_ptr, width, levels_ptr);
+        }
+
+        // notice: next conversions use SIMD kernels when available on the running CPU, selected once at first call
+        void convert_hdr_line(bmpl::clr::BGRA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept;
+        void convert_hdr_line(bmpl::clr::RGBA* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept;
+        void convert_hdr_line(bmpl::clr::BGR* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept;
+        void convert_hdr_line(bmpl::clr::RGB* pixels_ptr, const std::uint8_t* line_ptr, const std::size_t width, const std::uint8_t* levels_ptr) noexcept;
+
+
+        //===========================================================================
+        // Gathers the pixels of a line of 8-bits palette indices from a palette already converted into the final pixel type
+        template<typename PixelT>
+        inline void gather_palette_line(PixelT* pixels_ptr, const PixelT* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept
+        {
+            // notice: scalar gathering, used for any pixel type that gets no specialized gathering
+            for (std::size_t x = 0; x < count; ++x)
+                *pixels_ptr++ = palette_ptr[*indices_ptr++];
+        }
+
+        // notice: next gatherings use AVX2 gather instructions when available on the running CPU, selected once at first call
+        void gather_palette_line(bmpl::clr::BGRA* pixels_ptr, const bmpl::clr::BGRA* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept;
+        void gather_palette_line(bmpl::clr::RGBA* pixels_ptr, const bmpl::clr::RGBA* palette_ptr, const std::uint8_t* indices_ptr, const std::size_t count) noexcept;
+
+    }
+
+}
\ No newline at end of file
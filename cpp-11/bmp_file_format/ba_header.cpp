@@ -71,7 +71,14 @@ namespace bmpl
         //---------------------------------------------------------------------------
         bmpl::frmt::BAHeadersList BAHeader::get_BA_headers(const std::string& filepath) noexcept
         {
-            bmpl::utils::LEInStream in_stream(filepath);
+            bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+            return BAHeader::get_BA_headers(in_stream);
+        }
+
+        //---------------------------------------------------------------------------
+        bmpl::frmt::BAHeadersList BAHeader::get_BA_headers(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept
+        {
+            bmpl::utils::LEInStream in_stream(buffer_ptr, buffer_size);
             return BAHeader::get_BA_headers(in_stream);
         }
 
@@ -86,7 +93,7 @@ namespace bmpl
             auto mem_curs_pos{ in_stream.tellg() };
             in_stream.seekg(0);
             do {
-                std::uint16_t file_type;
+                std::uint16_t file_type{ 0 };
                 if ((in_stream >> file_type).failed()) {
                     ret_headers.set_error(in_stream.get_error());
                     break;
@@ -196,7 +203,7 @@ namespace bmpl
         //---------------------------------------------------------------------------
         const bool BAHeader::is_BA_file(const std::string& filepath) noexcept
         {
-            bmpl::utils::LEInStream in_stream(filepath);
+            bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
             return BAHeader::is_BA_file(in_stream);
         }
 
@@ -206,7 +213,7 @@ namespace bmpl
             if (in_stream.failed())
                 return false;
 
-            std::uint16_t control_word;
+            std::uint16_t control_word{ 0 };
             if ((in_stream >> control_word).failed())
                 return false;
 
@@ -229,7 +236,32 @@ namespace bmpl
             const BAHeadersList& ba_headers_list
         ) noexcept
             : bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::NO_ERROR)
-            , in_stream_ptr{ new bmpl::utils::LEInStream(filepath) }
+            , in_stream_ptr{ std::make_shared<bmpl::utils::LEInStream>(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED) }
+            , _begin(ba_headers_list.cbegin())
+            , _iter(ba_headers_list.cbegin())
+            , _sentinel(ba_headers_list.cend())
+        {}
+
+        //---------------------------------------------------------------------------
+        BAHeadersIterStatus::BAHeadersIterStatus(
+            const std::uint8_t* buffer_ptr,
+            const std::size_t buffer_size,
+            const BAHeadersList& ba_headers_list
+        ) noexcept
+            : bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::NO_ERROR)
+            , in_stream_ptr{ std::make_shared<bmpl::utils::LEInStream>(buffer_ptr, buffer_size) }
+            , _begin(ba_headers_list.cbegin())
+            , _iter(ba_headers_list.cbegin())
+            , _sentinel(ba_headers_list.cend())
+        {}
+
+        //---------------------------------------------------------------------------
+        BAHeadersIterStatus::BAHeadersIterStatus(
+            const bmpl::utils::LEInStream& in_stream,
+            const BAHeadersList& ba_headers_list
+        ) noexcept
+            : bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::NO_ERROR)
+            , in_stream_ptr{ std::make_shared<bmpl::utils::LEInStream>(in_stream) }
             , _begin(ba_headers_list.cbegin())
             , _iter(ba_headers_list.cbegin())
             , _sentinel(ba_headers_list.cend())
@@ -32,6 +32,7 @@ SOFTWARE.
 */
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -87,6 +88,9 @@ namespace bmpl
             [[nodiscard]]
             static BAHeadersList get_BA_headers(const std::string& filepath) noexcept;
 
+            [[nodiscard]]
+            static BAHeadersList get_BA_headers(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept;
+
             [[nodiscard]]
             static BAHeadersList get_BA_headers(bmpl::utils::LEInStream& in_stream) noexcept;
 
@@ -130,7 +134,7 @@ namespace bmpl
         class BAHeadersIterStatus : public bmpl::utils::ErrorStatus
         {
         public:
-            bmpl::utils::LEInStream* in_stream_ptr{ nullptr };
+            std::shared_ptr<bmpl::utils::LEInStream> in_stream_ptr{};
 
             BAHeadersIterStatus() noexcept = default;
             BAHeadersIterStatus(const BAHeadersIterStatus&) noexcept = default;
@@ -139,6 +143,10 @@ namespace bmpl
 
             BAHeadersIterStatus(const std::string& filepath, const BAHeadersList& ba_headers_list) noexcept;
 
+            BAHeadersIterStatus(const std::uint8_t* buffer_ptr, const std::size_t buffer_size, const BAHeadersList& ba_headers_list) noexcept;
+
+            BAHeadersIterStatus(const bmpl::utils::LEInStream& in_stream, const BAHeadersList& ba_headers_list) noexcept;  // notice: shares the source of in_stream
+
             const bmpl::frmt::BAHeader& operator*() noexcept;
             BAHeadersList::const_iterator operator++() noexcept;        // notice: pre-increment
             BAHeadersList::const_iterator operator++(int) noexcept;     // notice: post-increment
@@ -152,7 +152,7 @@ namespace bmpl
                         to_be_loaded_count = expected_colors_count;
                         set_warning(bmpl::utils::WarningCode::TOO_BIG_PALETTE);
                     }
-                    if (!in_stream.read(reinterpret_cast<char*>(MyContainerBaseClass::data()), std::streamsize(bytes_per_palette_color * to_be_loaded_count)))
+                    if (!in_stream.read(reinterpret_cast<char*>(MyContainerBaseClass::data()), std::size_t(bytes_per_palette_color * to_be_loaded_count)))
                         return _set_err(bmpl::utils::ErrorCode::BAD_COLORMAP_ENCODING);
                 }
                 else {
@@ -411,8 +411,9 @@ namespace bmpl
             if (bits_per_pixel != 1 && bits_per_pixel != 4 && bits_per_pixel != 8 && bits_per_pixel != 24)
                 return _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
 
-            if (compression_mode == COMPR_HUFFMAN_1D)
-                return _set_err(bmpl::utils::ErrorCode::NOT_YET_IMPLEMENTED_HUFFMAN_1D_DECODING);
+            if (compression_mode == COMPR_HUFFMAN_1D && bits_per_pixel != 1)
+                // notice: Huffman-1D encoding is defined for 2 colors bitmaps only
+                return _set_err(bmpl::utils::ErrorCode::BMP_BAD_ENCODING);
 
             if (compression_mode > COMPR_RLE_24)
                 return _set_err(bmpl::utils::ErrorCode::BMP_BAD_ENCODING);
@@ -121,6 +121,12 @@ namespace bmpl
                 return this->_clr_err();
             }
 
+            [[nodiscard]]
+            virtual inline const std::uint32_t get_bitmap_size() const noexcept
+            {
+                return 0;  // notice: unknown size
+            }
+
             [[nodiscard]]
             virtual inline const std::int32_t get_device_x_resolution() const noexcept
             {
@@ -332,6 +338,12 @@ namespace bmpl
                 load(in_stream, is_V3_base, is_V5_base);
             }
 
+            [[nodiscard]]
+            virtual inline const std::uint32_t get_bitmap_size() const noexcept override
+            {
+                return this->bitmap_size;
+            }
+
             [[nodiscard]]
             virtual inline const std::int32_t get_device_x_resolution() const noexcept override
             {
@@ -689,6 +701,12 @@ namespace bmpl
                 return application_identifier;
             }
 
+            [[nodiscard]]
+            virtual inline const std::uint32_t get_bitmap_size() const noexcept override
+            {
+                return this->bitmap_size;
+            }
+
             [[nodiscard]]
             virtual inline const std::int32_t get_device_x_resolution() const noexcept override
             {
@@ -0,0 +1,275 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <cstdlib>
+
+#include "bmp_probe.h"
+#include "../utils/little_endian_streaming.h"
+
+
+namespace bmpl
+{
+    namespace frmt
+    {
+        //===========================================================================
+        //  Local helpers
+        //---------------------------------------------------------------------------
+        static inline const std::uint32_t _probed_colors_count(const std::uint32_t used_colors, const std::uint16_t bits_per_pixel) noexcept
+        {
+            if (bits_per_pixel == 0 || bits_per_pixel > 8)
+                return 0;
+            else if (used_colors != 0)
+                return used_colors;
+            else
+                return std::uint32_t(1) << bits_per_pixel;
+        }
+
+        //---------------------------------------------------------------------------
+        static const bmpl::utils::ErrorCode _probe_image(
+            bmpl::utils::ByteSource& source,
+            const std::size_t header_offset,
+            BMPProbedImage& image
+        ) noexcept
+        {
+            using bmpl::utils::ErrorCode;
+            using bmpl::utils::get_le_uint16;
+            using bmpl::utils::get_le_uint32;
+
+            // notice: 14 bytes of file header followed by the first 40 bytes of the info header
+            std::uint8_t header[14 + 40]{};
+            const std::size_t read_count{ source.read_at(header_offset, header, sizeof(header)) };
+
+            if (read_count < 2)
+                return ErrorCode::END_OF_FILE;
+
+            const std::uint16_t file_type{ get_le_uint16(header) };
+
+            if (file_type == 0) {
+                // BMP v1.x
+                if (read_count < 10)
+                    return ErrorCode::END_OF_FILE;
+
+                const std::int16_t width{ std::int16_t(get_le_uint16(header + 2)) };
+                const std::int16_t height{ std::int16_t(get_le_uint16(header + 4)) };
+                if (width < 0)
+                    return ErrorCode::NEGATIVE_WIDTH;
+
+                image.width = std::uint32_t(width);
+                image.height = std::uint32_t(std::abs(height));
+                image.info_header_size = 0;
+                image.compression_mode = 0;
+                image.bits_per_pixel = header[9];
+                image.colors_count = _probed_colors_count(0, image.bits_per_pixel);
+                image.content_offset = 10;
+                image.device_x_resolution = 0;
+                image.device_y_resolution = 0;
+                image.top_down_encoding = false;
+            }
+            else if (file_type == 0x4d42) {  // i.e. 'BM' as per little-endian encoding
+                if (read_count < 18)
+                    return ErrorCode::END_OF_FILE;
+
+                image.content_offset = get_le_uint32(header + 10);
+                image.info_header_size = get_le_uint32(header + 14);
+
+                const std::uint8_t* info_ptr{ header + 18 };
+
+                switch (image.info_header_size) {
+                case 12:
+                    // BMP v2 and OS/2 v1.x
+                    {
+                        if (read_count < 18 + 8)
+                            return ErrorCode::END_OF_FILE;
+
+                        const std::int16_t width{ std::int16_t(get_le_uint16(info_ptr)) };
+                        const std::int16_t height{ std::int16_t(get_le_uint16(info_ptr + 2)) };
+                        if (width < 0)
+                            return ErrorCode::NEGATIVE_WIDTH;
+
+                        image.width = std::uint32_t(width);
+                        image.height = std::uint32_t(std::abs(height));
+                        image.top_down_encoding = height < 0;
+                        image.bits_per_pixel = get_le_uint16(info_ptr + 6);
+                        image.compression_mode = 0;
+                        image.colors_count = _probed_colors_count(0, image.bits_per_pixel);
+                        image.device_x_resolution = 0;
+                        image.device_y_resolution = 0;
+                    }
+                    break;
+
+                case 16:
+                case 64:
+                    // OS/2 v2.x
+                    if (read_count < std::size_t(image.info_header_size == 16 ? 18 + 12 : 18 + 32))
+                        return ErrorCode::END_OF_FILE;
+
+                    image.width = get_le_uint32(info_ptr);
+                    image.height = get_le_uint32(info_ptr + 4);
+                    image.top_down_encoding = false;
+                    image.bits_per_pixel = get_le_uint16(info_ptr + 10);
+                    if (image.info_header_size == 64) {
+                        image.compression_mode = get_le_uint32(info_ptr + 12);
+                        image.device_x_resolution = std::int32_t(get_le_uint32(info_ptr + 20));
+                        image.device_y_resolution = std::int32_t(get_le_uint32(info_ptr + 24));
+                        image.colors_count = _probed_colors_count(get_le_uint32(info_ptr + 28), image.bits_per_pixel);
+                    }
+                    else {
+                        image.compression_mode = 0;
+                        image.device_x_resolution = 0;
+                        image.device_y_resolution = 0;
+                        image.colors_count = _probed_colors_count(0, image.bits_per_pixel);
+                    }
+                    break;
+
+                case 40:
+                case 52:
+                case 56:
+                case 108:
+                case 124:
+                    // BMP v3 up to v5
+                    {
+                        if (read_count < sizeof(header))
+                            return ErrorCode::END_OF_FILE;
+
+                        const std::int32_t width{ std::int32_t(get_le_uint32(info_ptr)) };
+                        const std::int32_t height{ std::int32_t(get_le_uint32(info_ptr + 4)) };
+                        if (width < 0)
+                            return ErrorCode::NEGATIVE_WIDTH;
+
+                        image.width = std::uint32_t(width);
+                        image.height = height < 0 ? std::uint32_t(0) - std::uint32_t(height) : std::uint32_t(height);
+                        image.top_down_encoding = height < 0;
+                        image.bits_per_pixel = get_le_uint16(info_ptr + 10);
+                        image.compression_mode = get_le_uint32(info_ptr + 12);
+                        image.device_x_resolution = std::int32_t(get_le_uint32(info_ptr + 20));
+                        image.device_y_resolution = std::int32_t(get_le_uint32(info_ptr + 24));
+                        image.colors_count = _probed_colors_count(get_le_uint32(info_ptr + 28), image.bits_per_pixel);
+                    }
+                    break;
+
+                default:
+                    return ErrorCode::INVALID_HEADER_SIZE;
+                }
+            }
+            else {
+                return ErrorCode::BAD_FILE_HEADER;
+            }
+
+            if (image.width == 0 || image.height == 0)
+                return ErrorCode::INVALID_IMAGE_DIMENSIONS;
+
+            return ErrorCode::NO_ERROR;
+        }
+
+
+        //===========================================================================
+        //  probe()
+        //---------------------------------------------------------------------------
+        const BMPProbeInfo probe(const std::string& filepath) noexcept
+        {
+            bmpl::utils::FileByteSource source(filepath);
+            return probe(source);
+        }
+
+        //---------------------------------------------------------------------------
+        const BMPProbeInfo probe(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept
+        {
+            bmpl::utils::MemoryByteSource source(buffer_ptr, buffer_size);
+            return probe(source);
+        }
+
+        //---------------------------------------------------------------------------
+        const BMPProbeInfo probe(bmpl::utils::ByteSource& source) noexcept
+        {
+            using bmpl::utils::ErrorCode;
+
+            BMPProbeInfo probe_info{};  // notice: zero-initializes every field, error_code included
+
+            if (source.failed()) {
+                probe_info.error_code = source.get_error();
+                return probe_info;
+            }
+
+            probe_info.file_size = std::uint32_t(source.size());
+
+            std::uint8_t file_type_bytes[2];
+            if (source.read_at(0, file_type_bytes, 2) != 2) {
+                probe_info.error_code = ErrorCode::END_OF_FILE;
+                return probe_info;
+            }
+
+            if (bmpl::utils::get_le_uint16(file_type_bytes) != 0x4142) {  // i.e. not 'BA' as per little-endian encoding
+                probe_info.images_count = 1;
+                probe_info.error_code = _probe_image(source, 0, probe_info.images[0]);
+                return probe_info;
+            }
+
+            // BA files: walks through the list of BA headers
+            probe_info.is_BA_file = true;
+
+            std::size_t ba_offset{ 0 };
+            for (;;) {
+                std::uint8_t ba_header[14];  // notice: file type, header size, offset to next, screen width and height
+                if (source.read_at(ba_offset, ba_header, sizeof(ba_header)) != sizeof(ba_header)) {
+                    probe_info.error_code = ErrorCode::END_OF_FILE;
+                    break;
+                }
+
+                if (bmpl::utils::get_le_uint16(ba_header) != 0x4142) {
+                    probe_info.error_code = ErrorCode::NOT_BITMAP_ARRAY_FILE_HEADER;
+                    break;
+                }
+
+                if (probe_info.images_count < BMPProbeInfo::MAX_IMAGES_COUNT) {
+                    probe_info.error_code = _probe_image(source, ba_offset + sizeof(ba_header), probe_info.images[probe_info.images_count]);
+                    if (probe_info.failed())
+                        break;
+                }
+                probe_info.images_count++;
+
+                const std::size_t offset_to_next{ bmpl::utils::get_le_uint32(ba_header + 6) };
+                if (offset_to_next == 0)
+                    break;
+
+                if (offset_to_next <= ba_offset || offset_to_next >= source.size()) {
+                    probe_info.error_code = ErrorCode::INVALID_BA_NEXT_OFFSET_VALUE;
+                    break;
+                }
+
+                ba_offset = offset_to_next;
+            }
+
+            return probe_info;
+        }
+
+    }
+
+}
\ No newline at end of file
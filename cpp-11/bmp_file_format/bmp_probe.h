@@ -0,0 +1,102 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <cstdint>
+#include <string>
+
+#include "../utils/byte_sources.h"
+#include "../utils/errors.h"
+
+
+namespace bmpl
+{
+    namespace frmt
+    {
+        //===========================================================================
+        // Metadata of one image, as read from its headers only
+        struct BMPProbedImage
+        {
+            std::uint32_t width;
+            std::uint32_t height;
+            std::uint32_t info_header_size;     // notice: 0 for BMP v1.x files, 12, 16, 40, 52, 56, 64, 108 or 124 otherwise
+            std::uint32_t compression_mode;
+            std::uint32_t colors_count;         // notice: count of entries in palette, 0 when not palettized
+            std::uint32_t content_offset;
+            std::int32_t  device_x_resolution;  // notice: pixels per meter
+            std::int32_t  device_y_resolution;
+            std::uint16_t bits_per_pixel;
+            bool          top_down_encoding;
+        };
+
+
+        //===========================================================================
+        // Metadata of a BMP or BA file - this is a POD type, with no heap allocated content
+        struct BMPProbeInfo
+        {
+            static constexpr std::uint32_t MAX_IMAGES_COUNT{ 32 };
+
+            bmpl::utils::ErrorCode error_code;
+            std::uint32_t file_size;
+            std::uint32_t images_count;          // notice: may be greater than MAX_IMAGES_COUNT for BA files, only the first images get then probed
+            bool is_BA_file;
+            BMPProbedImage images[MAX_IMAGES_COUNT];
+
+            [[nodiscard]]
+            inline const bool failed() const noexcept
+            {
+                return error_code != bmpl::utils::ErrorCode::NO_ERROR;
+            }
+
+            [[nodiscard]]
+            inline const bool is_ok() const noexcept
+            {
+                return error_code == bmpl::utils::ErrorCode::NO_ERROR;
+            }
+
+        };
+
+
+        //===========================================================================
+        // Reads the sole headers of BMP and BA files, with no heap allocation and no pixels decoding
+        [[nodiscard]]
+        const BMPProbeInfo probe(const std::string& filepath) noexcept;
+
+        [[nodiscard]]
+        const BMPProbeInfo probe(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept;
+
+        [[nodiscard]]
+        const BMPProbeInfo probe(bmpl::utils::ByteSource& source) noexcept;
+
+    }
+
+}
\ No newline at end of file
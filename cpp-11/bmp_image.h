@@ -37,13 +37,17 @@ SOFTWARE.
 #define WIN32_LEAN_AND_MEAN
 
 
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 
 #include "bmp_file_format/ba_header.h"
+#include "bmp_file_format/bmp_probe.h"
 #include "bmp_loader/bmp_loader.h"
 #include "utils/list_with_status.h"
 
@@ -73,6 +77,21 @@ namespace bmpl
             const bool force_bottom_up_ = false
         ) noexcept;
 
+        inline BMPImage(
+            const std::uint8_t* buffer_ptr_,
+            const std::size_t buffer_size_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        inline BMPImage(
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
         BMPImage(
             bmpl::utils::LEInStream& in_stream,
             bmpl::frmt::BAHeader& ba_header,
@@ -115,6 +134,9 @@ namespace bmpl
         [[nodiscard]]
         inline const std::uint32_t get_height() const noexcept;
 
+        [[nodiscard]]
+        inline bmpl::utils::MemoryResource* get_memory_resource() const noexcept;
+
         [[nodiscard]]
         const std::vector<std::string> get_warnings_msg() const noexcept;
 
@@ -131,17 +153,101 @@ namespace bmpl
             const bool force_bottom_up_ = false
         ) noexcept;
 
+        const bool load_image(
+            const std::uint8_t* buffer_ptr_,
+            const std::size_t buffer_size_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_image(
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_into(
+            PixelT* dst_ptr_,
+            const std::size_t row_stride_bytes_,
+            const std::string& filepath_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_into(
+            PixelT* dst_ptr_,
+            const std::size_t row_stride_bytes_,
+            const std::uint8_t* buffer_ptr_,
+            const std::size_t buffer_size_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_into(
+            PixelT* dst_ptr_,
+            const std::size_t row_stride_bytes_,
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_region(
+            const std::uint32_t x_,
+            const std::uint32_t y_,
+            const std::uint32_t width_,
+            const std::uint32_t height_,
+            const std::string& filepath_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_region(
+            const std::uint32_t x_,
+            const std::uint32_t y_,
+            const std::uint32_t width_,
+            const std::uint32_t height_,
+            const std::uint8_t* buffer_ptr_,
+            const std::size_t buffer_size_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
+        const bool load_region(
+            const std::uint32_t x_,
+            const std::uint32_t y_,
+            const std::uint32_t width_,
+            const std::uint32_t height_,
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+            const bool apply_gamma_correction_ = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up_ = false
+        ) noexcept;
+
         [[nodiscard]]
         inline const bool is_BA_file() const noexcept;
 
         [[nodiscard]]
         static inline const bool is_BA_file(const std::string& filepath) noexcept;
 
+        [[nodiscard]]
+        static inline const bool is_BA_file(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept;
+
         [[nodiscard]]
         static const bool is_BA_file(bmpl::utils::LEInStream& in_stream) noexcept;
 
+        inline void set_memory_resource(bmpl::utils::MemoryResource* resource_ptr) noexcept;
+
 
     protected:
+        const bool _end_loading(const bool loaded) noexcept;
+
         [[nodiscard]]
         const bool _set_bmp_loader(
             const std::string& filepath_,
@@ -150,9 +256,13 @@ namespace bmpl
             const bool force_bottom_up_
         ) noexcept;
 
+        [[nodiscard]]
+        const bool _set_bmp_loader(MyBMPLoaderBaseClass* bmp_loader_ptr) noexcept;
+
 
     private:
         MyBMPLoaderBaseClass* _bmp_loader_ptr{ nullptr };
+        bmpl::utils::MemoryResource* _memory_resource_ptr{ nullptr };  // notice: nullptr stands for the default memory resource
 
         static inline const std::int32_t _resolution_to_dpi(const std::int32_t resolution) noexcept;
 
@@ -184,6 +294,56 @@ namespace bmpl
     ) noexcept;
 
 
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_all_images(
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bool apply_gamma_correction_ = false,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+        const bool force_bottom_up_ = false
+    ) noexcept;
+
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_all_images(
+        bmpl::utils::LEInStream& in_stream_,
+        const bool apply_gamma_correction_ = false,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+        const bool force_bottom_up_ = false
+    ) noexcept;
+
+
+    //===========================================================================
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_many(
+        const std::vector<std::string>& filepaths_,
+        const bool apply_gamma_correction_ = false,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+        const bool force_bottom_up_ = false,
+        const std::size_t workers_count_ = 0
+    ) noexcept;
+
+
+    //===========================================================================
+    template<typename PixelT>
+    const bmpl::utils::ErrorStatus load_rows(
+        const std::string& filepath_,
+        const bmpl::lodr::RowCallback<PixelT>& row_callback_,
+        const bool apply_gamma_correction_ = false,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+        const bool force_bottom_up_ = false
+    ) noexcept;
+
+    template<typename PixelT>
+    const bmpl::utils::ErrorStatus load_rows(
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bmpl::lodr::RowCallback<PixelT>& row_callback_,
+        const bool apply_gamma_correction_ = false,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_ = bmpl::clr::ESkippedPixelsMode::BLACK,
+        const bool force_bottom_up_ = false
+    ) noexcept;
+
+
     //===========================================================================
     template<typename BMPImageT>
     class NextImageLoader : public bmpl::utils::ErrorStatus
@@ -202,6 +362,14 @@ namespace bmpl
             const bool force_bottom_up = false
         ) noexcept;
 
+        NextImageLoader(
+            const std::uint8_t* buffer_ptr,
+            const std::size_t buffer_size,
+            const bool apply_gamma_correction = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up = false
+        ) noexcept;
+
         const bool end() const noexcept;
 
         const std::string get_error_msg() const noexcept;
@@ -214,6 +382,7 @@ namespace bmpl
 
 
     private:
+        bmpl::utils::LEInStream _in_stream{};  // notice: shared by all the images loaded from the BA file
         bmpl::frmt::BAHeadersList _ba_headers{};
         bmpl::frmt::BAHeadersIterStatus _ba_hdr_iter{};
         std::string _filepath{};
@@ -250,6 +419,37 @@ namespace bmpl
     }
 
 
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    BMPImage<PixelT>::BMPImage(
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+        : MyErrBaseClass()
+        , MyWarnBaseClass()
+    {
+        load_image(buffer_ptr_, buffer_size_, apply_gamma_correction_, skipped_mode_, force_bottom_up_);
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    BMPImage<PixelT>::BMPImage(
+        const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+        : MyErrBaseClass()
+        , MyWarnBaseClass()
+    {
+        load_image(source_ptr_, apply_gamma_correction_, skipped_mode_, force_bottom_up_);
+    }
+
+
     //---------------------------------------------------------------------------
     template<typename PixelT>
     BMPImage<PixelT>::BMPImage(
@@ -269,10 +469,7 @@ namespace bmpl
             _set_err(this->_bmp_loader_ptr->get_error());
         }
         else {
-            if (this->_bmp_loader_ptr->load_image_content())
-                _clr_err();
-            else
-                _set_err(this->_bmp_loader_ptr->get_error());
+            _end_loading(this->_bmp_loader_ptr->load_image_content());
         }
 
         if (ba_header.has_warnings()) {
@@ -358,6 +555,14 @@ namespace bmpl
     }
 
 
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    bmpl::utils::MemoryResource* BMPImage<PixelT>::get_memory_resource() const noexcept
+    {
+        return (this->_memory_resource_ptr != nullptr) ? this->_memory_resource_ptr : bmpl::utils::get_default_memory_resource();
+    }
+
+
     //---------------------------------------------------------------------------
     template<typename PixelT>
     const std::vector<std::string> BMPImage<PixelT>::get_warnings_msg() const noexcept
@@ -403,7 +608,16 @@ namespace bmpl
     template<typename PixelT>
     const bool BMPImage<PixelT>::is_BA_file(const std::string& filepath) noexcept
     {
-        bmpl::utils::LEInStream in_stream(filepath);
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        return BMPImage<PixelT>::is_BA_file(in_stream);
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::is_BA_file(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept
+    {
+        bmpl::utils::LEInStream in_stream(buffer_ptr, buffer_size);
         return BMPImage<PixelT>::is_BA_file(in_stream);
     }
 
@@ -434,7 +648,180 @@ namespace bmpl
         if (!_set_bmp_loader(filepath_, apply_gamma_correction_, skipped_mode_, force_bottom_up_))
             return false;
 
-        if (this->_bmp_loader_ptr->load_image_content())
+        return _end_loading(this->_bmp_loader_ptr->load_image_content());
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_image(
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        // notice: the content of the buffer is not copied, so it must stay alive while the image is being loaded
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(buffer_ptr_, buffer_size_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_image_content());
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_image(
+        const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(source_ptr_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_image_content());
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_into(
+        PixelT* dst_ptr_,
+        const std::size_t row_stride_bytes_,
+        const std::string& filepath_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        // notice: rows of the destination buffer are row_stride_bytes_ apart, the image content of this BMPImage stays empty
+        if (!_set_bmp_loader(filepath_, apply_gamma_correction_, skipped_mode_, force_bottom_up_))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_into(dst_ptr_, row_stride_bytes_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_into(
+        PixelT* dst_ptr_,
+        const std::size_t row_stride_bytes_,
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(buffer_ptr_, buffer_size_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_into(dst_ptr_, row_stride_bytes_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_into(
+        PixelT* dst_ptr_,
+        const std::size_t row_stride_bytes_,
+        const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(source_ptr_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_into(dst_ptr_, row_stride_bytes_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_region(
+        const std::uint32_t x_,
+        const std::uint32_t y_,
+        const std::uint32_t width_,
+        const std::uint32_t height_,
+        const std::string& filepath_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        // notice: the image content gets only the pixels of the region, and the dimensions of this BMPImage are the ones of the region
+        if (!_set_bmp_loader(filepath_, apply_gamma_correction_, skipped_mode_, force_bottom_up_))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_region(x_, y_, width_, height_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_region(
+        const std::uint32_t x_,
+        const std::uint32_t y_,
+        const std::uint32_t width_,
+        const std::uint32_t height_,
+        const std::uint8_t* buffer_ptr_,
+        const std::size_t buffer_size_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(buffer_ptr_, buffer_size_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_region(x_, y_, width_, height_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::load_region(
+        const std::uint32_t x_,
+        const std::uint32_t y_,
+        const std::uint32_t width_,
+        const std::uint32_t height_,
+        const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr_,
+        const bool apply_gamma_correction_,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode_,
+        const bool force_bottom_up_
+    ) noexcept
+    {
+        if (!_set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(source_ptr_, apply_gamma_correction_, skipped_mode_, force_bottom_up_)))
+            return false;
+
+        return _end_loading(this->_bmp_loader_ptr->load_region(x_, y_, width_, height_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    void BMPImage<PixelT>::set_memory_resource(bmpl::utils::MemoryResource* resource_ptr) noexcept
+    {
+        // notice: this resource gets used by next loadings of images, the current content is left unchanged
+        this->_memory_resource_ptr = resource_ptr;
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::_end_loading(const bool loaded) noexcept
+    {
+        // notice: the source of bytes is released as soon as the image has been loaded,
+        // so that no file descriptor or mapping is kept alive for the whole lifetime of images
+        this->_bmp_loader_ptr->release_source();
+
+        if (loaded)
             return _clr_err();
         else
             return _set_err(this->_bmp_loader_ptr->get_error());
@@ -449,18 +836,27 @@ namespace bmpl
         const bmpl::clr::ESkippedPixelsMode skipped_mode_,
         const bool force_bottom_up_
     ) noexcept
+    {
+        return _set_bmp_loader(bmpl::lodr::create_bmp_loader<PixelT>(filepath_, apply_gamma_correction_, skipped_mode_, force_bottom_up_));
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bool BMPImage<PixelT>::_set_bmp_loader(MyBMPLoaderBaseClass* bmp_loader_ptr) noexcept
     {
         if (this->_bmp_loader_ptr != nullptr)
             delete this->_bmp_loader_ptr;
 
-        this->_bmp_loader_ptr = bmpl::lodr::create_bmp_loader<PixelT>(filepath_, apply_gamma_correction_, skipped_mode_, force_bottom_up_);
-        
+        this->_bmp_loader_ptr = bmp_loader_ptr;
+
         if (this->_bmp_loader_ptr == nullptr)
             return _set_err(bmpl::utils::ErrorCode::BMP_LOADER_INSTANTIATION_FAILED);
 
         if (this->_bmp_loader_ptr->failed())
             return _set_err(this->_bmp_loader_ptr->get_error());
 
+        this->_bmp_loader_ptr->set_memory_resource(this->_memory_resource_ptr);
         return true;
     }
 
@@ -484,10 +880,38 @@ namespace bmpl
         const bmpl::clr::ESkippedPixelsMode skipped_mode,
         const bool force_bottom_up
     ) noexcept
+    {
+        bmpl::utils::LEInStream in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+        return load_all_images<BMPImageT>(in_stream, apply_gamma_correction, skipped_mode, force_bottom_up);
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_all_images(
+        const std::uint8_t* buffer_ptr,
+        const std::size_t buffer_size,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up
+    ) noexcept
+    {
+        bmpl::utils::LEInStream in_stream(buffer_ptr, buffer_size);
+        return load_all_images<BMPImageT>(in_stream, apply_gamma_correction, skipped_mode, force_bottom_up);
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_all_images(
+        bmpl::utils::LEInStream& in_stream,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up
+    ) noexcept
     {
         using BMPLoaderBase = typename BMPImageT::MyBMPLoaderBaseClass;
 
-        bmpl::utils::LEInStream in_stream(filepath);
         if (in_stream.failed())
             return BMPImagesList<BMPImageT>(in_stream.get_error());
 
@@ -509,6 +933,112 @@ namespace bmpl
 
 
 
+    //===========================================================================
+    // Local implementations - load_many<BMPImageT>()
+    //---------------------------------------------------------------------------
+    template<typename BMPImageT>
+    const BMPImagesList<BMPImageT> load_many(
+        const std::vector<std::string>& filepaths,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up,
+        const std::size_t workers_count
+    ) noexcept
+    {
+        BMPImagesList<BMPImageT> images_list{};
+
+        try {
+            images_list.resize(filepaths.size());
+        }
+        catch (...) {
+            return BMPImagesList<BMPImageT>(bmpl::utils::ErrorCode::UNABLE_TO_CREATE_BITMAP_LOADER);
+        }
+
+        // each worker loads the next not yet loaded image, so that reading files and decoding bitmaps overlap across workers
+        std::atomic<std::size_t> next_index{ 0 };
+        auto worker = [&]() noexcept
+        {
+            for (std::size_t index = next_index++; index < filepaths.size(); index = next_index++)
+                images_list[index].load_image(filepaths[index], apply_gamma_correction, skipped_mode, force_bottom_up);
+        };
+
+        std::size_t threads_count{ (workers_count > 0) ? workers_count : std::size_t(std::thread::hardware_concurrency()) };
+        if (threads_count > filepaths.size())
+            threads_count = filepaths.size();
+
+        // notice: the calling thread is one of the workers
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < threads_count; ++i) {
+            try {
+                threads.emplace_back(worker);
+            }
+            catch (...) {
+                break;  // notice: already running workers will load all images anyway
+            }
+        }
+
+        worker();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        return images_list;
+    }
+
+
+
+    //===========================================================================
+    // Local implementations - load_rows<PixelT>()
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bmpl::utils::ErrorStatus load_rows(
+        const std::string& filepath,
+        const bmpl::lodr::RowCallback<PixelT>& row_callback,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up
+    ) noexcept
+    {
+        std::unique_ptr<bmpl::lodr::BMPBottomUpLoader<PixelT>> bmp_loader_ptr{
+            bmpl::lodr::create_bmp_loader<PixelT>(filepath, apply_gamma_correction, skipped_mode, force_bottom_up)
+        };
+
+        if (bmp_loader_ptr == nullptr)
+            return bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::UNABLE_TO_CREATE_BITMAP_LOADER);
+
+        if (!bmp_loader_ptr->load_rows(row_callback))
+            return bmpl::utils::ErrorStatus(bmp_loader_ptr->get_error());
+
+        return bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::NO_ERROR);
+    }
+
+
+    //---------------------------------------------------------------------------
+    template<typename PixelT>
+    const bmpl::utils::ErrorStatus load_rows(
+        const std::uint8_t* buffer_ptr,
+        const std::size_t buffer_size,
+        const bmpl::lodr::RowCallback<PixelT>& row_callback,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up
+    ) noexcept
+    {
+        std::unique_ptr<bmpl::lodr::BMPBottomUpLoader<PixelT>> bmp_loader_ptr{
+            bmpl::lodr::create_bmp_loader<PixelT>(buffer_ptr, buffer_size, apply_gamma_correction, skipped_mode, force_bottom_up)
+        };
+
+        if (bmp_loader_ptr == nullptr)
+            return bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::UNABLE_TO_CREATE_BITMAP_LOADER);
+
+        if (!bmp_loader_ptr->load_rows(row_callback))
+            return bmpl::utils::ErrorStatus(bmp_loader_ptr->get_error());
+
+        return bmpl::utils::ErrorStatus(bmpl::utils::ErrorCode::NO_ERROR);
+    }
+
+
+
     //===========================================================================
     // Local implementations - NextImageLoader<BMPImageT>
     //---------------------------------------------------------------------------
@@ -520,8 +1050,9 @@ namespace bmpl
         const bool force_bottom_up
     ) noexcept
         : MyErrBaseClass()
-        , _ba_headers(bmpl::frmt::BAHeader::get_BA_headers(filepath))
-        , _ba_hdr_iter(filepath, _ba_headers)
+        , _in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED)
+        , _ba_headers(bmpl::frmt::BAHeader::get_BA_headers(_in_stream))
+        , _ba_hdr_iter(_in_stream, _ba_headers)
         , _filepath(filepath)
         , _skipped_mode(skipped_mode)
         , _apply_gamma_correction(apply_gamma_correction)
@@ -539,6 +1070,36 @@ namespace bmpl
     }
 
 
+    //---------------------------------------------------------------------------
+    template<typename BMPImageT>
+    NextImageLoader<BMPImageT>::NextImageLoader(
+        const std::uint8_t* buffer_ptr,
+        const std::size_t buffer_size,
+        const bool apply_gamma_correction,
+        const bmpl::clr::ESkippedPixelsMode skipped_mode,
+        const bool force_bottom_up
+    ) noexcept
+        : MyErrBaseClass()
+        , _in_stream(buffer_ptr, buffer_size)
+        , _ba_headers(bmpl::frmt::BAHeader::get_BA_headers(_in_stream))
+        , _ba_hdr_iter(_in_stream, _ba_headers)
+        , _filepath()
+        , _skipped_mode(skipped_mode)
+        , _apply_gamma_correction(apply_gamma_correction)
+        , _force_bottom_up(force_bottom_up)
+    {
+        if (this->_ba_headers.failed()) {
+            _set_err(this->_ba_headers.get_error());
+        }
+        else if (this->_ba_hdr_iter.failed()) {
+            _set_err(this->_ba_hdr_iter.get_error());
+        }
+        else {
+            _clr_err();
+        }
+    }
+
+
     //---------------------------------------------------------------------------
     template<typename BMPImageT>
     const bool NextImageLoader<BMPImageT>::end() const noexcept
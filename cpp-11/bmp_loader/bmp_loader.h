@@ -39,8 +39,8 @@ SOFTWARE.
 
 #include <cmath>
 #include <cstring>
-#include <iostream>
-#include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,9 +49,11 @@ SOFTWARE.
 #include "../bmp_file_bitmaps/bmp_bitmaps.h"
 #include "../bmp_file_format/bmp_file_header.h"
 #include "../bmp_file_format/bmp_info.h"
+#include "../utils/byte_sources.h"
 #include "../utils/colors.h"
 #include "../utils/errors.h"
 #include "../utils/little_endian_streaming.h"
+#include "../utils/memory_resources.h"
 #include "../utils/warnings.h"
 
 
@@ -85,6 +87,13 @@ namespace bmpl
         using BGRABottomUpLoader = BMPBottomUpLoader<bmpl::clr::BGRA>;
 
 
+        //===========================================================================
+        // Rows streaming callback - gets the index of the row in final image, a pointer to its pixels and its width.
+        // Returning false cancels the streaming of the remaining rows.
+        template<typename PixelT>
+        using RowCallback = std::function<const bool(const std::uint32_t row_index, const PixelT* row_ptr, const std::uint32_t row_width)>;
+
+
         //===========================================================================
         template<typename PixelT>
         class BMPBottomUpLoader : public bmpl::utils::ErrorStatus, public bmpl::utils::WarningStatus
@@ -94,10 +103,11 @@ namespace bmpl
             using MyWarnBaseClass = bmpl::utils::WarningStatus;
 
             using pixel_type = PixelT;
+            using content_type = bmpl::utils::NoInitResourceVector<pixel_type>;
 
             static constexpr bool APPLY_GAMMA_CORRECTION{ true };
 
-            std::vector<pixel_type> image_content{};
+            content_type image_content{};
             std::string filepath{};
             std::uint32_t image_height{ 0 };
             std::uint32_t image_width{ 0 };
@@ -114,6 +124,25 @@ namespace bmpl
                 const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK
             ) noexcept;
 
+            BMPBottomUpLoader(
+                const std::uint8_t* buffer_ptr,
+                const std::size_t buffer_size,
+                const bool apply_gamma_correction = false,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK
+            ) noexcept;
+
+            BMPBottomUpLoader(
+                const std::uint8_t* buffer_ptr,
+                const std::size_t buffer_size,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode
+            ) noexcept;
+
+            BMPBottomUpLoader(
+                const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr,
+                const bool apply_gamma_correction = false,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK
+            ) noexcept;
+
             BMPBottomUpLoader(
                 const bmpl::utils::LEInStream& in_stream,
                 const bmpl::frmt::BAHeader& ba_header,
@@ -150,6 +179,9 @@ namespace bmpl
             [[nodiscard]]
             inline const std::uint32_t get_height() const noexcept;
 
+            [[nodiscard]]
+            inline bmpl::utils::MemoryResource* get_memory_resource() const noexcept;
+
             [[nodiscard]]
             inline const bool get_top_down_encoding() const noexcept;
 
@@ -165,6 +197,29 @@ namespace bmpl
             [[nodiscard]]
             virtual const bool load_image_content() noexcept;
 
+            [[nodiscard]]
+            virtual const bool load_into(pixel_type* dst_ptr, const std::size_t row_stride_bytes) noexcept;
+
+            [[nodiscard]]
+            virtual const bool load_region(const std::uint32_t x, const std::uint32_t y, const std::uint32_t width, const std::uint32_t height) noexcept;
+
+            [[nodiscard]]
+            virtual const bool load_region_into(
+                pixel_type* dst_ptr,
+                const std::size_t row_stride_bytes,
+                const std::uint32_t x,
+                const std::uint32_t y,
+                const std::uint32_t width,
+                const std::uint32_t height
+            ) noexcept;
+
+            [[nodiscard]]
+            virtual const bool load_rows(const RowCallback<pixel_type>& row_callback) noexcept;
+
+            inline void release_source() noexcept;
+
+            inline void set_memory_resource(bmpl::utils::MemoryResource* resource_ptr) noexcept;
+
 
         protected:
             bmpl::clr::ESkippedPixelsMode             _skipped_mode{ bmpl::clr::ESkippedPixelsMode::BLACK };
@@ -175,19 +230,48 @@ namespace bmpl
             bmpl::frmt::BMPInfo                       _info{};
             bmpl::bmpf::BitmapLoaderBase<pixel_type>* _bitmap_loader_ptr{ nullptr };
 
+            const bool _load_image(
+                const bool reversed_rows,
+                pixel_type* dst_ptr = nullptr,
+                const std::size_t row_stride_bytes = 0,
+                const bmpl::bmpf::ImageRegion* region_ptr = nullptr
+            ) noexcept;
+
+            const bool _load_rows(const RowCallback<pixel_type>& row_callback, const bool reversed_rows) noexcept;
+
 
         private:
             std::vector<bmpl::frmt::BAHeader> _ba_headers_list{};
             int _ba_current_header_index{ -1 };
+            bmpl::utils::MemoryResource* _memory_resource_ptr{ bmpl::utils::get_default_memory_resource() };
 
             const bool _allocate_image_space(const std::size_t image_width, const std::size_t image_height) noexcept;
 
+            void _append_loading_warnings() noexcept;
+
+            void _check_initialization() noexcept;
+
+            void _correct_gamma(pixel_type* pixels_ptr, const std::size_t pixels_count) const noexcept;
+
             inline const std::uint32_t _evaluate_colors_count(const std::uint32_t colors_count) const noexcept
             {
                 return (colors_count == 0) ? 0xffff'ffff : colors_count;
             }
 
-            const bool _load_image_content(const std::size_t content_offset, const std::uint32_t image_width, const std::uint32_t image_height) noexcept;
+            [[nodiscard]]
+            const pixel_type _get_default_pixel() noexcept;
+
+            const bool _load_image_content(
+                const std::size_t content_offset,
+                const std::uint32_t image_width,
+                const std::uint32_t image_height,
+                const bool reversed_rows,
+                pixel_type* dst_ptr,
+                const std::size_t row_stride_bytes,
+                const bmpl::bmpf::ImageRegion* region_ptr
+            ) noexcept;
+
+            void _select_bitmap(std::size_t& content_offset, std::uint32_t& image_width, std::uint32_t& image_height) noexcept;
 
         };
 
@@ -214,6 +298,31 @@ namespace bmpl
                 : MyBaseClass(filepath, skipped_mode)
             {}
 
+            inline BMPLoader(
+                const std::uint8_t* buffer_ptr,
+                const std::size_t buffer_size,
+                const bool apply_gamma_correction = false,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK
+            ) noexcept
+                : MyBaseClass(buffer_ptr, buffer_size, apply_gamma_correction, skipped_mode)
+            {}
+
+            inline BMPLoader(
+                const std::uint8_t* buffer_ptr,
+                const std::size_t buffer_size,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode
+            ) noexcept
+                : MyBaseClass(buffer_ptr, buffer_size, skipped_mode)
+            {}
+
+            inline BMPLoader(
+                const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr,
+                const bool apply_gamma_correction = false,
+                const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK
+            ) noexcept
+                : MyBaseClass(source_ptr, apply_gamma_correction, skipped_mode)
+            {}
+
             BMPLoader(
                 const bmpl::utils::LEInStream& in_stream,
                 const bmpl::frmt::BAHeader& ba_header,
@@ -228,9 +337,24 @@ namespace bmpl
             [[nodiscard]]
             virtual const bool load_image_content() noexcept override;
 
+            [[nodiscard]]
+            virtual const bool load_into(PixelT* dst_ptr, const std::size_t row_stride_bytes) noexcept override;
 
-        private:
-            void _reverse_lines_ordering() noexcept;
+            [[nodiscard]]
+            virtual const bool load_region(const std::uint32_t x, const std::uint32_t y, const std::uint32_t width, const std::uint32_t height) noexcept override;
+
+            [[nodiscard]]
+            virtual const bool load_region_into(
+                PixelT* dst_ptr,
+                const std::size_t row_stride_bytes,
+                const std::uint32_t x,
+                const std::uint32_t y,
+                const std::uint32_t width,
+                const std::uint32_t height
+            ) noexcept override;
+
+            [[nodiscard]]
+            virtual const bool load_rows(const bmpl::lodr::RowCallback<PixelT>& row_callback) noexcept override;
 
         };
 
@@ -251,6 +375,39 @@ namespace bmpl
         }
 
 
+        //===========================================================================
+        template<typename PixelT>
+        BMPLoaderBase<PixelT>* create_bmp_loader(
+            const std::uint8_t* buffer_ptr,
+            const std::size_t buffer_size,
+            const bool apply_gamma_correction = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up = false
+        ) noexcept
+        {
+            if (force_bottom_up)
+                return new bmpl::lodr::BMPBottomUpLoader<PixelT>(buffer_ptr, buffer_size, apply_gamma_correction, skipped_mode);
+            else
+                return new bmpl::lodr::BMPLoader<PixelT>(buffer_ptr, buffer_size, apply_gamma_correction, skipped_mode);
+        }
+
+
+        //===========================================================================
+        template<typename PixelT>
+        BMPLoaderBase<PixelT>* create_bmp_loader(
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr,
+            const bool apply_gamma_correction = false,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode = bmpl::clr::ESkippedPixelsMode::BLACK,
+            const bool force_bottom_up = false
+        ) noexcept
+        {
+            if (force_bottom_up)
+                return new bmpl::lodr::BMPBottomUpLoader<PixelT>(source_ptr, apply_gamma_correction, skipped_mode);
+            else
+                return new bmpl::lodr::BMPLoader<PixelT>(source_ptr, apply_gamma_correction, skipped_mode);
+        }
+
+
         //===========================================================================
         template<typename PixelT>
         BMPLoaderBase<PixelT>* create_bmp_loader(
@@ -283,7 +440,7 @@ namespace bmpl
             , filepath(filepath)
             , _skipped_mode(skipped_mode)
             , _apply_gamma_correction(apply_gamma_correction)
-            , _in_stream(filepath)
+            , _in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED)
             , _file_header_ptr{ bmpl::frmt::create_file_header(_in_stream) }
             , _info(_in_stream, _file_header_ptr)
             , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
@@ -292,20 +449,7 @@ namespace bmpl
                 this->_info.info_header_ptr,
                 this->_info.color_map) }
         {
-            if (_in_stream.failed())
-                _set_err(_in_stream.get_error());
-            else if (_file_header_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
-            else if (_file_header_ptr->failed())
-                _set_err(_file_header_ptr->get_error());
-            else if (_info.failed())
-                _set_err(_info.get_error());
-            else if (_bitmap_loader_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
-            else if (_bitmap_loader_ptr->failed())
-                _set_err(_bitmap_loader_ptr->get_error());
-            else
-                _clr_err();
+            _check_initialization();
         }
 
 
@@ -320,7 +464,7 @@ namespace bmpl
             , filepath(filepath)
             , _skipped_mode(skipped_mode)
             , _apply_gamma_correction(!APPLY_GAMMA_CORRECTION)
-            , _in_stream(filepath)
+            , _in_stream(filepath, bmpl::utils::LEInStream::MEMORY_MAPPED)
             , _file_header_ptr{ bmpl::frmt::create_file_header(_in_stream) }
             , _info(_in_stream, _file_header_ptr)
             , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
@@ -329,20 +473,83 @@ namespace bmpl
                 this->_info.info_header_ptr,
                 this->_info.color_map) }
         {
-            if (_in_stream.failed())
-                _set_err(_in_stream.get_error());
-            else if (_file_header_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
-            else if (_file_header_ptr->failed())
-                _set_err(_file_header_ptr->get_error());
-            else if (_info.failed())
-                _set_err(_info.get_error());
-            else if (_bitmap_loader_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
-            else if (_bitmap_loader_ptr->failed())
-                _set_err(_bitmap_loader_ptr->get_error());
-            else
-                _clr_err();
+            _check_initialization();
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        BMPBottomUpLoader<PixelT>::BMPBottomUpLoader(
+            const std::uint8_t* buffer_ptr,
+            const std::size_t buffer_size,
+            const bool apply_gamma_correction,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode
+        ) noexcept
+            : MyErrBaseClass()
+            , MyWarnBaseClass()
+            , filepath()
+            , _skipped_mode(skipped_mode)
+            , _apply_gamma_correction(apply_gamma_correction)
+            , _in_stream(buffer_ptr, buffer_size)
+            , _file_header_ptr{ bmpl::frmt::create_file_header(_in_stream) }
+            , _info(_in_stream, _file_header_ptr)
+            , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
+                this->_in_stream,
+                this->_file_header_ptr,
+                this->_info.info_header_ptr,
+                this->_info.color_map) }
+        {
+            _check_initialization();
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        BMPBottomUpLoader<PixelT>::BMPBottomUpLoader(
+            const std::uint8_t* buffer_ptr,
+            const std::size_t buffer_size,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode
+        ) noexcept
+            : MyErrBaseClass()
+            , MyWarnBaseClass()
+            , filepath()
+            , _skipped_mode(skipped_mode)
+            , _apply_gamma_correction(!APPLY_GAMMA_CORRECTION)
+            , _in_stream(buffer_ptr, buffer_size)
+            , _file_header_ptr{ bmpl::frmt::create_file_header(_in_stream) }
+            , _info(_in_stream, _file_header_ptr)
+            , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
+                this->_in_stream,
+                this->_file_header_ptr,
+                this->_info.info_header_ptr,
+                this->_info.color_map) }
+        {
+            _check_initialization();
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        BMPBottomUpLoader<PixelT>::BMPBottomUpLoader(
+            const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr,
+            const bool apply_gamma_correction,
+            const bmpl::clr::ESkippedPixelsMode skipped_mode
+        ) noexcept
+            : MyErrBaseClass()
+            , MyWarnBaseClass()
+            , filepath()
+            , _skipped_mode(skipped_mode)
+            , _apply_gamma_correction(apply_gamma_correction)
+            , _in_stream(source_ptr)
+            , _file_header_ptr{ bmpl::frmt::create_file_header(_in_stream) }
+            , _info(_in_stream, _file_header_ptr)
+            , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
+                this->_in_stream,
+                this->_file_header_ptr,
+                this->_info.info_header_ptr,
+                this->_info.color_map) }
+        {
+            _check_initialization();
         }
 
 
@@ -359,7 +566,7 @@ namespace bmpl
             , filepath(in_stream.filepath)
             , _skipped_mode(skipped_mode)
             , _apply_gamma_correction(!APPLY_GAMMA_CORRECTION)
-            , _in_stream(in_stream.filepath)
+            , _in_stream(in_stream)
             , _file_header_ptr{ ba_header.file_header_ptr }
             , _info(ba_header.info_header_ptr, ba_header.color_map)
             , _bitmap_loader_ptr{ bmpl::bmpf::create_bitmap_loader<PixelT>(
@@ -368,20 +575,7 @@ namespace bmpl
                 this->_info.info_header_ptr,
                 this->_info.color_map) }
         {
-            if (_in_stream.failed())
-                _set_err(_in_stream.get_error());
-            else if (_file_header_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
-            else if (_file_header_ptr->failed())
-                _set_err(_file_header_ptr->get_error());
-            else if (_info.failed())
-                _set_err(_info.get_error());
-            else if (_bitmap_loader_ptr == nullptr)
-                _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
-            else if (_bitmap_loader_ptr->failed())
-                _set_err(_bitmap_loader_ptr->get_error());
-            else
-                _clr_err();
+            _check_initialization();
         }
 
 
@@ -392,8 +586,14 @@ namespace bmpl
             if (this->_file_header_ptr == nullptr)
                 return bmpl::frmt::BAHeadersList(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
             
-            if (this->_file_header_ptr->is_BA_file())
-                return get_BA_headers(this->_in_stream);
+            if (this->_file_header_ptr->is_BA_file()) {
+                if (this->_in_stream.is_open() || this->filepath.empty())
+                    return get_BA_headers(this->_in_stream);
+
+                // the source has been released once the image content got loaded, so let's reopen the file
+                bmpl::utils::LEInStream in_stream(this->filepath, bmpl::utils::LEInStream::MEMORY_MAPPED);
+                return get_BA_headers(in_stream);
+            }
             else
                 return bmpl::frmt::BAHeadersList(bmpl::utils::ErrorCode::NOT_BITMAP_ARRAY_FILE_HEADER);
 
@@ -411,7 +611,7 @@ namespace bmpl
 
             in_stream.seekg(0);
             do {
-                std::uint16_t file_type;
+                std::uint16_t file_type{ 0 };
                 if ((in_stream >> file_type).failed()) {
                     ret_headers.set_error(in_stream.get_error());
                     break;
@@ -522,6 +722,14 @@ namespace bmpl
         }
 
 
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        inline bmpl::utils::MemoryResource* BMPBottomUpLoader<PixelT>::get_memory_resource() const noexcept
+        {
+            return this->_memory_resource_ptr;
+        }
+
+
         //---------------------------------------------------------------------------
         template<typename PixelT>
         inline const bool BMPBottomUpLoader<PixelT>::get_top_down_encoding() const noexcept
@@ -568,55 +776,117 @@ namespace bmpl
         //---------------------------------------------------------------------------
         template<typename PixelT>
         const bool BMPBottomUpLoader<PixelT>::load_image_content() noexcept
+        {
+            // notice: lines are stored in their bitmap order
+            return _load_image(false);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::load_into(pixel_type* dst_ptr, const std::size_t row_stride_bytes) noexcept
+        {
+            // notice: lines are stored in their bitmap order
+            if (dst_ptr == nullptr)
+                return _set_err(bmpl::utils::ErrorCode::INVALID_DESTINATION_BUFFER);
+            return _load_image(false, dst_ptr, row_stride_bytes);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::load_region(
+            const std::uint32_t x,
+            const std::uint32_t y,
+            const std::uint32_t width,
+            const std::uint32_t height
+        ) noexcept
+        {
+            // notice: lines are stored in their bitmap order, so y is the index of the first line of the region in bitmap
+            const bmpl::bmpf::ImageRegion region{ x, y, width, height };
+            return _load_image(false, nullptr, 0, &region);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::load_region_into(
+            pixel_type* dst_ptr,
+            const std::size_t row_stride_bytes,
+            const std::uint32_t x,
+            const std::uint32_t y,
+            const std::uint32_t width,
+            const std::uint32_t height
+        ) noexcept
+        {
+            // notice: lines are stored in their bitmap order
+            if (dst_ptr == nullptr)
+                return _set_err(bmpl::utils::ErrorCode::INVALID_DESTINATION_BUFFER);
+            const bmpl::bmpf::ImageRegion region{ x, y, width, height };
+            return _load_image(false, dst_ptr, row_stride_bytes, &region);
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::_load_image(
+            const bool reversed_rows,
+            pixel_type* dst_ptr,
+            const std::size_t row_stride_bytes,
+            const bmpl::bmpf::ImageRegion* region_ptr
+        ) noexcept
         {
             if (failed()) {
                 // some former error arised
                 return false;
             }
 
-            if (is_BA_file()) {
-                // this is a multi array bitmaps file, let's load the content of the very first image in array
-                this->_in_stream.seekg(sizeof(std::int16_t));
-                bmpl::frmt::BAHeader first_ba_header(this->_in_stream);
-                this->_bitmap_loader_ptr = bmpl::bmpf::create_bitmap_loader<PixelT>(
-                    this->_in_stream,
-                    first_ba_header.file_header_ptr,
-                    first_ba_header.info_header_ptr,
-                    first_ba_header.color_map
-                );
+            std::size_t content_offset;
+            std::uint32_t image_width, image_height;
+            _select_bitmap(content_offset, image_width, image_height);
 
-                return _load_image_content(first_ba_header.get_content_offset(), first_ba_header.get_width(), first_ba_header.get_height());
-            }
-            else {
-                // this is a BMP image file
-                return _load_image_content(
-                    this->_file_header_ptr->get_content_offset(),
-                    this->_info.info_header_ptr->get_width(),
-                    this->_info.info_header_ptr->get_height());
-            }
+            // notice: the source of bytes is kept open, so that loaders may decode their image many times, see release_source()
+            return _load_image_content(content_offset, image_width, image_height, reversed_rows, dst_ptr, row_stride_bytes, region_ptr);
         }
 
 
         //---------------------------------------------------------------------------
         template<typename PixelT>
-        const bool BMPBottomUpLoader<PixelT>::_allocate_image_space(const std::size_t image_width, const std::size_t image_height) noexcept
+        const bool BMPBottomUpLoader<PixelT>::load_rows(const RowCallback<pixel_type>& row_callback) noexcept
         {
-            try {
-                pixel_type pixel_default_value{};
+            // notice: rows are delivered in their bitmap order
+            return _load_rows(row_callback, false);
+        }
 
-                switch (_skipped_mode)
-                {
-                case bmpl::clr::ESkippedPixelsMode::TRANSPARENCY:
-                    bmpl::clr::set_full_transparency(pixel_default_value);
-                    break;
 
-                case bmpl::clr::ESkippedPixelsMode::PALETTE_INDEX_0:
-                    bmpl::clr::convert(pixel_default_value, this->_info.color_map[0]);
-                    break;
-                }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        inline void BMPBottomUpLoader<PixelT>::release_source() noexcept
+        {
+            // notice: no more decoding can be done once the source of bytes has been released
+            this->_in_stream.close();
+        }
 
-                this->image_content.assign(image_width * image_height, pixel_default_value);
 
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        inline void BMPBottomUpLoader<PixelT>::set_memory_resource(bmpl::utils::MemoryResource* resource_ptr) noexcept
+        {
+            // notice: the image content and the decoding buffers get their memory from this resource when next loading
+            this->_memory_resource_ptr = (resource_ptr != nullptr) ? resource_ptr : bmpl::utils::get_default_memory_resource();
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::_allocate_image_space(const std::size_t image_width, const std::size_t image_height) noexcept
+        {
+            try {
+                // notice: the former content, if any, is released into its own memory resource
+                if (this->image_content.get_allocator().resource() != this->_memory_resource_ptr)
+                    this->image_content = content_type(this->_memory_resource_ptr);
+                // notice: pixels are not initialized here since every one of them gets written while decoding, skipped pixels of RLE bitmaps included
+                this->image_content.resize(image_width * image_height);
                 return true;
             }
             catch (...) {
@@ -627,30 +897,43 @@ namespace bmpl
 
         //---------------------------------------------------------------------------
         template<typename PixelT>
-        const bool BMPBottomUpLoader<PixelT>::_load_image_content(
-            const std::size_t content_offset,
-            const std::uint32_t image_width,
-            const std::uint32_t image_height
-        ) noexcept
+        void BMPBottomUpLoader<PixelT>::_append_loading_warnings() noexcept
         {
-            this->image_content.clear();
-            this->image_width = 0;
-            this->image_height = 0;
+            this->append_warnings(*this->_file_header_ptr);
+            this->append_warnings(*this->_info.info_header_ptr);
+            this->append_warnings(this->_info.color_map);
+            this->append_warnings(*_bitmap_loader_ptr);
 
-            // loads the image bitmap
-            if (this->_in_stream.seekg(content_offset).fail()) {
-                _set_err(bmpl::utils::ErrorCode::ERRONEOUS_BITMAP_OFFSET);
-                return false;
-            }
+            this->set_unique_warnings();
+        }
 
-            if (!this->_allocate_image_space(image_width, image_height)) {
-                return false;
-            }
 
-            if (!this->_bitmap_loader_ptr->load(this->image_content)) {
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BMPBottomUpLoader<PixelT>::_check_initialization() noexcept
+        {
+            if (_in_stream.failed())
+                _set_err(_in_stream.get_error());
+            else if (_file_header_ptr == nullptr)
+                _set_err(bmpl::utils::ErrorCode::BAD_FILE_HEADER);
+            else if (_file_header_ptr->failed())
+                _set_err(_file_header_ptr->get_error());
+            else if (_info.failed())
+                _set_err(_info.get_error());
+            else if (_bitmap_loader_ptr == nullptr)
+                _set_err(bmpl::utils::ErrorCode::BAD_BITS_PER_PIXEL_VALUE);
+            else if (_bitmap_loader_ptr->failed())
                 _set_err(_bitmap_loader_ptr->get_error());
-                return false;
-            }
+            else
+                _clr_err();
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BMPBottomUpLoader<PixelT>::_correct_gamma(pixel_type* pixels_ptr, const std::size_t pixels_count) const noexcept
+        {
+            const pixel_type* pixels_end{ pixels_ptr + pixels_count };
 
             // is there gamma correction to apply?
             if (this->_apply_gamma_correction) {
@@ -665,8 +948,8 @@ namespace bmpl
                         const double gamma_r{ double(info_header_ptr->gamma_red) };
                         const double gamma_g{ double(info_header_ptr->gamma_green) };
                         const double gamma_b{ double(info_header_ptr->gamma_blue) };
-                        for (auto& pxl : this->image_content)
-                            bmpl::clr::gamma_correction(pxl, gamma_r, gamma_g, gamma_b);
+                        for (pixel_type* pxl_ptr = pixels_ptr; pxl_ptr != pixels_end; ++pxl_ptr)
+                            bmpl::clr::gamma_correction(*pxl_ptr, gamma_r, gamma_g, gamma_b);
                     }
                 }
                 else if (this->_info.info_header_ptr->is_v5()) {
@@ -675,85 +958,289 @@ namespace bmpl
                         const double gamma_r{ double(info_header_ptr->gamma_red) };
                         const double gamma_g{ double(info_header_ptr->gamma_green) };
                         const double gamma_b{ double(info_header_ptr->gamma_blue) };
-                        for (auto& pxl : this->image_content)
-                            bmpl::clr::gamma_correction(pxl, gamma_r, gamma_g, gamma_b);
+                        for (pixel_type* pxl_ptr = pixels_ptr; pxl_ptr != pixels_end; ++pxl_ptr)
+                            bmpl::clr::gamma_correction(*pxl_ptr, gamma_r, gamma_g, gamma_b);
                     }
                     else
                         if (info_header_ptr->cs_type == bmpl::clr::ELogicalColorSpace::S_RGB) {
-                            for (auto& pxl : this->image_content)
-                                bmpl::clr::gamma_correction(pxl, 2.2, 2.2, 2.2);  // notice: gamma value 2.2 is a widely accepted approximation.
+                            for (pixel_type* pxl_ptr = pixels_ptr; pxl_ptr != pixels_end; ++pxl_ptr)
+                                bmpl::clr::gamma_correction(*pxl_ptr, 2.2, 2.2, 2.2);  // notice: gamma value 2.2 is a widely accepted approximation.
                         }
                 }
             }
-            else if (this->_info.info_header_ptr->bits_per_pixel == 64) {
-                // this is a specific case for which an HDR image has to be decalibrated to be shown on displays
-                constexpr double gamma{ double(1.0 / 2.2) };  // notice: 2.2 is a very common value that suits most cases
-                for (auto& pxl : this->image_content)
-                    bmpl::clr::gamma_correction(pxl, gamma, gamma, gamma);
+            // notice: otherwise, HDR images get decalibrated to be shown on displays by their bitmap loader, while being decoded
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const typename BMPBottomUpLoader<PixelT>::pixel_type BMPBottomUpLoader<PixelT>::_get_default_pixel() noexcept
+        {
+            pixel_type pixel_default_value{};
+
+            switch (_skipped_mode)
+            {
+            case bmpl::clr::ESkippedPixelsMode::TRANSPARENCY:
+                bmpl::clr::set_full_transparency(pixel_default_value);
+                break;
+
+            case bmpl::clr::ESkippedPixelsMode::PALETTE_INDEX_0:
+                bmpl::clr::convert(pixel_default_value, this->_info.color_map[0]);
+                break;
+            }
+
+            return pixel_default_value;
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::_load_image_content(
+            const std::size_t content_offset,
+            const std::uint32_t image_width,
+            const std::uint32_t image_height,
+            const bool reversed_rows,
+            pixel_type* dst_ptr,
+            const std::size_t row_stride_bytes,
+            const bmpl::bmpf::ImageRegion* region_ptr
+        ) noexcept
+        {
+            this->image_content.clear();
+            this->image_width = 0;
+            this->image_height = 0;
+
+            // the whole image gets loaded, or only a region of it that must be fully contained in the image
+            bmpl::bmpf::ImageRegion region{ 0, 0, image_width, image_height };
+            if (region_ptr != nullptr) {
+                if (region_ptr->width == 0 || region_ptr->height == 0 ||
+                    region_ptr->width > image_width || region_ptr->x > image_width - region_ptr->width ||
+                    region_ptr->height > image_height || region_ptr->y > image_height - region_ptr->height)
+                    return _set_err(bmpl::utils::ErrorCode::INVALID_IMAGE_REGION);
+                region = *region_ptr;
+            }
+
+            // loads the image bitmap
+            if (this->_in_stream.seekg(content_offset).fail()) {
+                _set_err(bmpl::utils::ErrorCode::ERRONEOUS_BITMAP_OFFSET);
+                return false;
             }
 
+            const std::size_t row_size{ region.width * sizeof(pixel_type) };
+            std::size_t row_stride{ row_size };
+
+            if (dst_ptr == nullptr) {
+                // the image content is owned by this loader
+                if (!this->_allocate_image_space(region.width, region.height))
+                    return false;
+                dst_ptr = this->image_content.data();
+            }
+            else {
+                // the image content is decoded into the caller's buffer, rows of which may be padded
+                if (row_stride_bytes < row_size)
+                    return _set_err(bmpl::utils::ErrorCode::INVALID_DESTINATION_BUFFER);
+                row_stride = row_stride_bytes;
+            }
+
+            this->_bitmap_loader_ptr->set_hdr_tone_mapping(!this->_apply_gamma_correction);
+            this->_bitmap_loader_ptr->set_memory_resource(this->_memory_resource_ptr);
+            // notice: reversed bitmaps get their lines decoded straight into their final rows
+            const bmpl::bmpf::ImageRows<pixel_type> image_rows(dst_ptr, row_stride, region.height, reversed_rows);
+            bool loaded{ false };
+            if (region_ptr == nullptr)
+                loaded = this->_bitmap_loader_ptr->load(image_rows, this->_get_default_pixel());
+            else {
+                // notice: the region of reversed bitmaps starts at their line of the last row of the region
+                bmpl::bmpf::ImageRegion bitmap_region{ region };
+                if (reversed_rows)
+                    bitmap_region.y = image_height - region.y - region.height;
+                loaded = this->_bitmap_loader_ptr->load_region(image_rows, bitmap_region, this->_get_default_pixel());
+            }
+            if (!loaded) {
+                _set_err(_bitmap_loader_ptr->get_error());
+                return false;
+            }
+
+            // applies gamma correction when needed
+            if (row_stride == row_size)
+                this->_correct_gamma(dst_ptr, region.width * region.height);
+            else
+                for (std::size_t line = 0; line < region.height; ++line)
+                    this->_correct_gamma(image_rows.get_row(line), region.width);
+
             // once here, everything was fine
-            this->image_width = image_width;
-            this->image_height = image_height;
+            this->image_width = std::uint32_t(region.width);
+            this->image_height = std::uint32_t(region.height);
             _clr_err();
 
             // let's finally append any maybe warning detected during processing
-            this->append_warnings(*this->_file_header_ptr);
-            this->append_warnings(*this->_info.info_header_ptr);
-            this->append_warnings(this->_info.color_map);
-            this->append_warnings(*_bitmap_loader_ptr);
-
-            this->set_unique_warnings();
+            this->_append_loading_warnings();
 
             return true;
         }
 
 
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPBottomUpLoader<PixelT>::_load_rows(const RowCallback<pixel_type>& row_callback, const bool reversed_rows) noexcept
+        {
+            if (failed()) {
+                // some former error arised
+                return false;
+            }
+
+            std::size_t content_offset;
+            std::uint32_t image_width, image_height;
+            _select_bitmap(content_offset, image_width, image_height);
+
+            bool loaded{ false };
+
+            if (this->_in_stream.seekg(content_offset).fail()) {
+                _set_err(bmpl::utils::ErrorCode::ERRONEOUS_BITMAP_OFFSET);
+            }
+            else {
+                // each decoded row gets gamma corrected, then is delivered with its index in final image
+                this->_bitmap_loader_ptr->set_hdr_tone_mapping(!this->_apply_gamma_correction);
+                this->_bitmap_loader_ptr->set_memory_resource(this->_memory_resource_ptr);
+                loaded = this->_bitmap_loader_ptr->load_rows(
+                    [&](const std::uint32_t row_index, pixel_type* row_ptr, const std::uint32_t row_width) -> bool
+                    {
+                        this->_correct_gamma(row_ptr, row_width);
+                        try {
+                            return row_callback(reversed_rows ? image_height - 1 - row_index : row_index, row_ptr, row_width);
+                        }
+                        catch (...) {
+                            return false;  // notice: exceptions thrown by the row callback cancel the streaming
+                        }
+                    },
+                    this->_get_default_pixel()
+                );
+
+                if (loaded) {
+                    _clr_err();
+                    this->_append_loading_warnings();
+                }
+                else
+                    _set_err(_bitmap_loader_ptr->get_error());
+            }
+
+            return loaded;
+        }
+
+
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        void BMPBottomUpLoader<PixelT>::_select_bitmap(
+            std::size_t& content_offset,
+            std::uint32_t& image_width,
+            std::uint32_t& image_height
+        ) noexcept
+        {
+            if (is_BA_file()) {
+                // this is a multi array bitmaps file, let's load the content of the very first image in array
+                this->_in_stream.seekg(sizeof(std::int16_t));
+                bmpl::frmt::BAHeader first_ba_header(this->_in_stream);
+                // notice: bitmaps may be selected once per decoding, so the previous bitmap loader is released first
+                delete this->_bitmap_loader_ptr;
+                this->_bitmap_loader_ptr =bmpl::bmpf::create_bitmap_loader<PixelT>(
+                    this->_in_stream,
+                    first_ba_header.file_header_ptr,
+                    first_ba_header.info_header_ptr,
+                    first_ba_header.color_map
+                );
+
+                content_offset = first_ba_header.get_content_offset();
+                image_width = first_ba_header.get_width();
+                image_height = first_ba_header.get_height();
+            }
+            else {
+                // this is a BMP image file
+                content_offset = this->_file_header_ptr->get_content_offset();
+                image_width = this->_info.info_header_ptr->get_width();
+                image_height = this->_info.info_header_ptr->get_height();
+            }
+        }
+
+
         //===========================================================================
         // Local implementations  -  BMPLoader<PixelT>
         //---------------------------------------------------------------------------
         template<typename PixelT>
         const bool BMPLoader<PixelT>::load_image_content() noexcept
         {
-            if (MyBaseClass::load_image_content()) {
-                if (MyBaseClass::_info.info_header_ptr != nullptr &&
-                    !MyBaseClass::_info.info_header_ptr->top_down_encoding)
-                {
-                    _reverse_lines_ordering();
-                }
-                return true;
-            }
-            else
-                return false;
+            // notice: bottom-up encoded bitmaps get their lines decoded from the bottom row of final image up to its top one
+            return MyBaseClass::_load_image(
+                MyBaseClass::_info.info_header_ptr != nullptr && !MyBaseClass::_info.info_header_ptr->top_down_encoding
+            );
         }
 
 
         //---------------------------------------------------------------------------
         template<typename PixelT>
-        void BMPLoader<PixelT>::_reverse_lines_ordering() noexcept
+        const bool BMPLoader<PixelT>::load_into(PixelT* dst_ptr, const std::size_t row_stride_bytes) noexcept
         {
-            if (this->is_ok()) {
+            // notice: bottom-up encoded bitmaps get their lines decoded from the bottom row of the caller's buffer up to its top one
+            if (dst_ptr == nullptr)
+                return MyBaseClass::_set_err(bmpl::utils::ErrorCode::INVALID_DESTINATION_BUFFER);
+            return MyBaseClass::_load_image(
+                MyBaseClass::_info.info_header_ptr != nullptr && !MyBaseClass::_info.info_header_ptr->top_down_encoding,
+                dst_ptr,
+                row_stride_bytes
+            );
+        }
 
-                const std::size_t image_width{ this->image_width };
-                const std::size_t image_height{ this->image_height };
-                const std::size_t line_width{ image_width * sizeof(PixelT) };
 
-                std::vector<std::uint8_t> tmp_line;
-                tmp_line.assign(line_width, 0);
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPLoader<PixelT>::load_region(
+            const std::uint32_t x,
+            const std::uint32_t y,
+            const std::uint32_t width,
+            const std::uint32_t height
+        ) noexcept
+        {
+            // notice: y is the index of the top row of the region in final image, whatever the encoding of its bitmap
+            const bmpl::bmpf::ImageRegion region{ x, y, width, height };
+            return MyBaseClass::_load_image(
+                MyBaseClass::_info.info_header_ptr != nullptr && !MyBaseClass::_info.info_header_ptr->top_down_encoding,
+                nullptr,
+                0,
+                &region
+            );
+        }
+
 
-                std::uint8_t* upline_ptr{ reinterpret_cast<std::uint8_t*>(this->image_content.data()) };
-                std::uint8_t* botline_ptr{ reinterpret_cast<std::uint8_t*>(this->image_content.data() + (image_height - 1) * image_width) };
-                std::uint8_t* tmpline_ptr{ tmp_line.data() };
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPLoader<PixelT>::load_region_into(
+            PixelT* dst_ptr,
+            const std::size_t row_stride_bytes,
+            const std::uint32_t x,
+            const std::uint32_t y,
+            const std::uint32_t width,
+            const std::uint32_t height
+        ) noexcept
+        {
+            if (dst_ptr == nullptr)
+                return MyBaseClass::_set_err(bmpl::utils::ErrorCode::INVALID_DESTINATION_BUFFER);
+            const bmpl::bmpf::ImageRegion region{ x, y, width, height };
+            return MyBaseClass::_load_image(
+                MyBaseClass::_info.info_header_ptr != nullptr && !MyBaseClass::_info.info_header_ptr->top_down_encoding,
+                dst_ptr,
+                row_stride_bytes,
+                &region
+            );
+        }
 
-                for (std::size_t i = 0; i < image_height / 2; ++i) {
-                    std::memcpy(tmpline_ptr, upline_ptr, line_width);
-                    std::memcpy(upline_ptr, botline_ptr, line_width);
-                    std::memcpy(botline_ptr, tmpline_ptr, line_width);
 
-                    upline_ptr += line_width;
-                    botline_ptr -= line_width;
-                }
-            }
+        //---------------------------------------------------------------------------
+        template<typename PixelT>
+        const bool BMPLoader<PixelT>::load_rows(const bmpl::lodr::RowCallback<PixelT>& row_callback) noexcept
+        {
+            // notice: bottom-up encoded bitmaps get their rows indexed from the top of final image
+            return MyBaseClass::_load_rows(
+                row_callback,
+                MyBaseClass::_info.info_header_ptr != nullptr && !MyBaseClass::_info.info_header_ptr->top_down_encoding
+            );
         }
     }
 
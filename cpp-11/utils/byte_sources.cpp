@@ -0,0 +1,386 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "byte_sources.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //===========================================================================
+        //  FileByteSource
+        //---------------------------------------------------------------------------
+        constexpr std::size_t FileByteSource::DIRECT_IO_ALIGNMENT;
+        constexpr std::size_t FileByteSource::DIRECT_IO_BUFFER_SIZE;
+
+
+        //---------------------------------------------------------------------------
+        FileByteSource::FileByteSource(const std::string& filepath, const FileAccessHints& hints) noexcept
+            : MyBaseClass()
+            , _hints(hints)
+        {
+            // direct reads get their aligned intermediate buffer first - notice: direct reads are in use only while this buffer is set
+            if (_hints.direct_io) {
+                try {
+                    _direct_buffer.resize(DIRECT_IO_BUFFER_SIZE + DIRECT_IO_ALIGNMENT);
+                    const std::size_t misalignment{ std::size_t(reinterpret_cast<std::uintptr_t>(_direct_buffer.data()) % DIRECT_IO_ALIGNMENT) };
+                    _direct_buffer_ptr = _direct_buffer.data() + (misalignment > 0 ? DIRECT_IO_ALIGNMENT - misalignment : 0);
+                }
+                catch (...) {
+                    _direct_buffer_ptr = nullptr;
+                }
+            }
+
+#if defined(_WIN32)
+            DWORD flags{ FILE_ATTRIBUTE_NORMAL };
+            if (_hints.sequential)
+                flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+
+            HANDLE file_handle{ INVALID_HANDLE_VALUE };
+            if (_direct_buffer_ptr != nullptr)
+                file_handle = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags | FILE_FLAG_NO_BUFFERING, nullptr);
+            if (file_handle == INVALID_HANDLE_VALUE) {
+                _direct_buffer_ptr = nullptr;
+                file_handle = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+            }
+            if (file_handle == INVALID_HANDLE_VALUE) {
+                _set_err(ErrorCode::FILE_NOT_FOUND);
+                return;
+            }
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file_handle, &file_size)) {
+                CloseHandle(file_handle);
+                _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+                return;
+            }
+
+            _file_handle = file_handle;
+            _size = std::size_t(file_size.QuadPart);
+
+#else
+#if defined(O_DIRECT)
+            if (_direct_buffer_ptr != nullptr)
+                _fd = ::open(filepath.c_str(), O_RDONLY | O_DIRECT);  // notice: fails on file systems that do not support direct reads, e.g. tmpfs
+#endif
+            if (_fd < 0) {
+                _direct_buffer_ptr = nullptr;
+                _fd = ::open(filepath.c_str(), O_RDONLY);
+            }
+            if (_fd < 0) {
+                _set_err(ErrorCode::FILE_NOT_FOUND);
+                return;
+            }
+
+            struct stat file_stat;
+            if (::fstat(_fd, &file_stat) != 0 || S_ISDIR(file_stat.st_mode)) {
+                ::close(_fd);
+                _fd = -1;
+                _set_err(ErrorCode::FILE_NOT_FOUND);
+                return;
+            }
+
+            _size = std::size_t(file_stat.st_size);
+
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+            // notice: no alignment constraint there, so no intermediate buffer is needed
+            if (_hints.direct_io)
+                ::fcntl(_fd, F_NOCACHE, 1);
+#endif
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+            if (_hints.sequential)
+                ::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+            if (_hints.will_need && _direct_buffer_ptr == nullptr)
+                ::posix_fadvise(_fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+#endif
+
+            if (_direct_buffer_ptr == nullptr)
+                std::vector<std::uint8_t>().swap(_direct_buffer);
+
+            _clr_err();
+        }
+
+
+        //---------------------------------------------------------------------------
+        FileByteSource::~FileByteSource() noexcept
+        {
+#if defined(_WIN32)
+            if (_file_handle != nullptr)
+                CloseHandle(_file_handle);
+#else
+            if (_fd >= 0) {
+#if defined(POSIX_FADV_DONTNEED)
+                if (_hints.dont_need)
+                    ::posix_fadvise(_fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+                ::close(_fd);
+            }
+#endif
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t FileByteSource::read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            if (failed() || offset >= _size)
+                return 0;
+
+            const std::size_t to_be_read{ (count < _size - offset) ? count : _size - offset };
+
+            if (_direct_buffer_ptr != nullptr)
+                return _read_direct(offset, dst_ptr, to_be_read);
+            else
+                return _read_file(offset, dst_ptr, to_be_read);
+        }
+
+
+        //---------------------------------------------------------------------------
+        void FileByteSource::will_need(const std::size_t offset, const std::size_t count) noexcept
+        {
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+            // notice: direct reads do not go through the page cache, so reading ahead would be useless there
+            if (_fd >= 0 && _direct_buffer_ptr == nullptr && count > 0)
+                ::posix_fadvise(_fd, off_t(offset), off_t(count), POSIX_FADV_WILLNEED);
+#endif
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t FileByteSource::_read_direct(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            // notice: the intermediate buffer is shared by all the streams on this source
+            std::lock_guard<std::mutex> lock(_direct_mutex);
+
+            std::size_t read_count{ 0 };
+
+            while (read_count < count) {
+                // reads whole aligned blocks into the intermediate buffer, then copies their requested part
+                const std::size_t current_offset{ offset + read_count };
+                const std::size_t block_offset{ current_offset - current_offset % DIRECT_IO_ALIGNMENT };
+                const std::size_t skipped_size{ current_offset - block_offset };
+                const std::size_t remaining{ count - read_count };
+                const std::size_t aligned_size{ (skipped_size + remaining + DIRECT_IO_ALIGNMENT - 1) / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT };
+                const std::size_t block_size{ std::min(aligned_size, DIRECT_IO_BUFFER_SIZE) };
+
+                const std::size_t block_read{ _read_file(block_offset, _direct_buffer_ptr, block_size) };
+                if (block_read <= skipped_size)
+                    break;
+
+                const std::size_t copied_size{ std::min(block_read - skipped_size, remaining) };
+                std::memcpy(dst_ptr + read_count, _direct_buffer_ptr + skipped_size, copied_size);
+                read_count += copied_size;
+
+                if (block_read < block_size)
+                    break;  // i.e. end of file
+            }
+
+            return read_count;
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t FileByteSource::_read_file(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            std::size_t read_count{ 0 };
+
+            while (read_count < count) {
+#if defined(_WIN32)
+                const std::uint64_t current_offset{ std::uint64_t(offset + read_count) };
+                OVERLAPPED overlapped{};
+                overlapped.Offset = DWORD(current_offset & 0xffff'ffff);
+                overlapped.OffsetHigh = DWORD(current_offset >> 32);
+
+                const std::size_t remaining{ count - read_count };
+                const DWORD chunk_size{ DWORD(remaining < 0x4000'0000 ? remaining : 0x4000'0000) };
+                DWORD chunk_read{ 0 };
+                if (!ReadFile(_file_handle, dst_ptr + read_count, chunk_size, &chunk_read, &overlapped) || chunk_read == 0)
+                    break;
+#else
+                const ssize_t chunk_read{ ::pread(_fd, dst_ptr + read_count, count - read_count, off_t(offset + read_count)) };
+                if (chunk_read <= 0)
+                    break;
+#endif
+                read_count += std::size_t(chunk_read);
+            }
+
+            return read_count;
+        }
+
+
+        //===========================================================================
+        //  MappedByteSource
+        //---------------------------------------------------------------------------
+        const std::uint8_t* MappedByteSource::get_view(const std::size_t offset, const std::size_t count) noexcept
+        {
+            if (offset > _mapping.size() || count > _mapping.size() - offset)
+                return nullptr;
+            else
+                return _mapping.data() + offset;
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t MappedByteSource::read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            if (offset >= _mapping.size())
+                return 0;
+
+            const std::size_t read_count{ (count < _mapping.size() - offset) ? count : _mapping.size() - offset };
+            std::memcpy(dst_ptr, _mapping.data() + offset, read_count);
+            return read_count;
+        }
+
+
+        //===========================================================================
+        //  MemoryByteSource
+        //---------------------------------------------------------------------------
+        MemoryByteSource::MemoryByteSource(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept
+            : MyBaseClass()
+            , _buffer_ptr(buffer_ptr)
+            , _buffer_size(buffer_ptr != nullptr ? buffer_size : 0)
+        {
+            if (buffer_ptr == nullptr)
+                _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            else
+                _clr_err();
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::uint8_t* MemoryByteSource::get_view(const std::size_t offset, const std::size_t count) noexcept
+        {
+            if (offset > _buffer_size || count > _buffer_size - offset)
+                return nullptr;
+            else
+                return _buffer_ptr + offset;
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t MemoryByteSource::read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            if (offset >= _buffer_size)
+                return 0;
+
+            const std::size_t read_count{ (count < _buffer_size - offset) ? count : _buffer_size - offset };
+            std::memcpy(dst_ptr, _buffer_ptr + offset, read_count);
+            return read_count;
+        }
+
+
+        //===========================================================================
+        //  CallbackByteSource
+        //---------------------------------------------------------------------------
+        CallbackByteSource::CallbackByteSource(const ReadAtCallback& read_at_callback, const std::size_t source_size) noexcept
+            : MyBaseClass()
+            , _read_at_callback(read_at_callback)
+            , _source_size(source_size)
+        {
+            if (!_read_at_callback)
+                _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            else
+                _clr_err();
+        }
+
+
+        //---------------------------------------------------------------------------
+        const std::size_t CallbackByteSource::read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            if (failed() || offset >= _source_size)
+                return 0;
+
+            const std::size_t to_be_read{ (count < _source_size - offset) ? count : _source_size - offset };
+            std::size_t read_count{ 0 };
+
+            // notice: callbacks may return less bytes than requested, e.g. with network streams, so reads are repeated up to a null count
+            while (read_count < to_be_read) {
+                std::size_t chunk_count{ 0 };
+                try {
+                    chunk_count = _read_at_callback(offset + read_count, dst_ptr + read_count, to_be_read - read_count);
+                }
+                catch (...) {
+                    return read_count;
+                }
+                if (chunk_count == 0)
+                    break;
+                read_count += (chunk_count < to_be_read - read_count) ? chunk_count : to_be_read - read_count;
+            }
+
+            return read_count;
+        }
+
+
+        //===========================================================================
+        std::shared_ptr<ByteSource> create_file_byte_source(const std::string& filepath, const bool memory_mapped) noexcept
+        {
+            try {
+                if (memory_mapped) {
+                    std::shared_ptr<ByteSource> mapped_source_ptr{ std::make_shared<MappedByteSource>(filepath) };
+                    if (mapped_source_ptr->is_ok())
+                        return mapped_source_ptr;
+                    // notice: falls back to regular file reading (e.g. on empty files or on not-mappable devices)
+                }
+
+                return std::make_shared<FileByteSource>(filepath);
+            }
+            catch (...) {
+                return nullptr;
+            }
+        }
+
+
+        //---------------------------------------------------------------------------
+        std::shared_ptr<ByteSource> create_file_byte_source(const std::string& filepath, const FileAccessHints& hints) noexcept
+        {
+            try {
+                return std::make_shared<FileByteSource>(filepath, hints);
+            }
+            catch (...) {
+                return nullptr;
+            }
+        }
+
+    }
+}
\ No newline at end of file
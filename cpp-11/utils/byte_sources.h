@@ -0,0 +1,262 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+
+// Let's exclude rarely-used stuff from Windows headers
+// (gets no effect on non Windows platforms)
+#define WIN32_LEAN_AND_MEAN
+
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "errors.h"
+#include "memory_mapping.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //===========================================================================
+        class ByteSource : public bmpl::utils::ErrorStatus
+        {
+        public:
+
+            using MyErrBaseClass = bmpl::utils::ErrorStatus;
+
+
+            ByteSource() noexcept = default;
+
+            ByteSource(const ByteSource&) noexcept = delete;
+            ByteSource(ByteSource&&) noexcept = delete;
+
+            virtual ~ByteSource() noexcept = default;
+
+            ByteSource& operator= (const ByteSource&) noexcept = delete;
+            ByteSource& operator= (ByteSource&&) noexcept = delete;
+
+
+            [[nodiscard]]
+            virtual inline const std::uint8_t* get_view(const std::size_t /*offset*/, const std::size_t /*count*/) noexcept
+            {
+                return nullptr;  // notice: contiguous views are optional; sources that cannot provide them just return nullptr
+            }
+
+            [[nodiscard]]
+            virtual const std::size_t read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept = 0;  // notice: returns the count of actually read bytes
+
+            [[nodiscard]]
+            virtual const std::size_t size() const noexcept = 0;
+
+            virtual inline void will_need(const std::size_t /*offset*/, const std::size_t /*count*/) noexcept
+            {}  // notice: hints the source that these bytes will be read soon; sources that cannot get use of it just ignore it
+
+        };
+
+
+        //===========================================================================
+        struct FileAccessHints
+        {
+            bool sequential{ false };   // notice: the file content is mostly read in increasing offsets order, which enlarges the kernel readahead
+            bool will_need{ false };    // notice: the whole file content gets read ahead as soon as the file is opened
+            bool dont_need{ false };    // notice: the file content gets dropped from the page cache once the source is released
+            bool direct_io{ false };    // notice: reads bypass the page cache through an aligned intermediate buffer; ignored where not available
+        };
+
+
+        //===========================================================================
+        class FileByteSource : public ByteSource
+        {
+        public:
+
+            using MyBaseClass = ByteSource;
+
+
+            static constexpr std::size_t DIRECT_IO_ALIGNMENT{ 4096 };           // notice: a multiple of the logical block size of most storage devices
+            static constexpr std::size_t DIRECT_IO_BUFFER_SIZE{ 1024 * 1024 };  // notice: a multiple of DIRECT_IO_ALIGNMENT
+
+
+            FileByteSource(const std::string& filepath, const FileAccessHints& hints = FileAccessHints()) noexcept;
+
+            virtual ~FileByteSource() noexcept;
+
+
+            [[nodiscard]]
+            virtual const std::size_t read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual inline const std::size_t size() const noexcept override
+            {
+                return this->_size;
+            }
+
+            virtual void will_need(const std::size_t offset, const std::size_t count) noexcept override;
+
+
+        private:
+#if defined(_WIN32)
+            void* _file_handle{ nullptr };
+#else
+            int _fd{ -1 };
+#endif
+            std::size_t _size{ 0 };
+            FileAccessHints _hints{};
+
+            // the aligned intermediate buffer of direct reads, which is empty when direct reads are not in use
+            std::vector<std::uint8_t> _direct_buffer{};
+            std::uint8_t* _direct_buffer_ptr{ nullptr };
+            std::mutex _direct_mutex{};
+
+
+            const std::size_t _read_direct(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept;
+            const std::size_t _read_file(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept;
+
+        };
+
+
+        //===========================================================================
+        class MappedByteSource : public ByteSource
+        {
+        public:
+
+            using MyBaseClass = ByteSource;
+
+
+            inline MappedByteSource(const std::string& filepath) noexcept
+                : MyBaseClass()
+                , _mapping(filepath)
+            {
+                _set_err(_mapping.get_error());
+            }
+
+            virtual ~MappedByteSource() noexcept = default;
+
+
+            [[nodiscard]]
+            virtual const std::uint8_t* get_view(const std::size_t offset, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual const std::size_t read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual inline const std::size_t size() const noexcept override
+            {
+                return this->_mapping.size();
+            }
+
+
+        private:
+            bmpl::utils::MemoryMapping _mapping;
+
+        };
+
+
+        //===========================================================================
+        class MemoryByteSource : public ByteSource
+        {
+        public:
+
+            using MyBaseClass = ByteSource;
+
+
+            MemoryByteSource(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept;  // notice: the buffer content is not copied and must outlive this source
+
+            virtual ~MemoryByteSource() noexcept = default;
+
+
+            [[nodiscard]]
+            virtual const std::uint8_t* get_view(const std::size_t offset, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual const std::size_t read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual inline const std::size_t size() const noexcept override
+            {
+                return this->_buffer_size;
+            }
+
+
+        private:
+            const std::uint8_t* _buffer_ptr{ nullptr };
+            std::size_t _buffer_size{ 0 };
+
+        };
+
+
+        //===========================================================================
+        class CallbackByteSource : public ByteSource
+        {
+        public:
+
+            using MyBaseClass = ByteSource;
+
+            // notice: the callback gets the offset, the destination pointer and the count of bytes to be read, and returns the count of actually read bytes;
+            // it may return less bytes than requested, it is then called again for the next ones, while returning 0 stands for the end of the source
+            using ReadAtCallback = std::function<std::size_t(const std::size_t, std::uint8_t*, const std::size_t)>;
+
+
+            CallbackByteSource(const ReadAtCallback& read_at_callback, const std::size_t source_size) noexcept;
+
+            virtual ~CallbackByteSource() noexcept = default;
+
+
+            [[nodiscard]]
+            virtual const std::size_t read_at(const std::size_t offset, std::uint8_t* dst_ptr, const std::size_t count) noexcept override;
+
+            [[nodiscard]]
+            virtual inline const std::size_t size() const noexcept override
+            {
+                return this->_source_size;
+            }
+
+
+        private:
+            ReadAtCallback _read_at_callback{};
+            std::size_t _source_size{ 0 };
+
+        };
+
+
+        //===========================================================================
+        std::shared_ptr<ByteSource> create_file_byte_source(const std::string& filepath, const bool memory_mapped) noexcept;
+
+        std::shared_ptr<ByteSource> create_file_byte_source(const std::string& filepath, const FileAccessHints& hints) noexcept;
+
+    }
+}
\ No newline at end of file
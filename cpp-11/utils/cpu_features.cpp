@@ -0,0 +1,127 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BMPL_X86_CPUID_MSVC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define BMPL_X86_CPUID_GCC
+#endif
+
+#include "cpu_features.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+#if defined(BMPL_X86_CPUID_MSVC) || defined(BMPL_X86_CPUID_GCC)
+        //===========================================================================
+        //  Local helpers
+        //---------------------------------------------------------------------------
+        static inline void _cpuid(const std::uint32_t leaf, const std::uint32_t subleaf, std::uint32_t registers[4]) noexcept
+        {
+#if defined(BMPL_X86_CPUID_MSVC)
+            int regs[4];
+            __cpuidex(regs, int(leaf), int(subleaf));
+            for (int i = 0; i < 4; ++i)
+                registers[i] = std::uint32_t(regs[i]);
+#else
+            unsigned int eax, ebx, ecx, edx;
+            __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+            registers[0] = eax;
+            registers[1] = ebx;
+            registers[2] = ecx;
+            registers[3] = edx;
+#endif
+        }
+
+        //---------------------------------------------------------------------------
+        static inline const std::uint64_t _read_xcr0() noexcept
+        {
+#if defined(BMPL_X86_CPUID_MSVC)
+            return std::uint64_t(_xgetbv(0));
+#else
+            std::uint32_t eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return std::uint64_t(eax) | (std::uint64_t(edx) << 32);
+#endif
+        }
+
+        //---------------------------------------------------------------------------
+        static const CPUFeatures _evaluate_cpu_features() noexcept
+        {
+            CPUFeatures features;
+            std::uint32_t registers[4];  // i.e. eax, ebx, ecx and edx
+
+            _cpuid(0, 0, registers);
+            const std::uint32_t max_leaf{ registers[0] };
+            if (max_leaf < 1)
+                return features;
+
+            _cpuid(1, 0, registers);
+            features.ssse3 = (registers[2] & (1u << 9)) != 0;
+            const bool os_saves_avx{
+                (registers[2] & (1u << 27)) != 0 &&     // i.e. OSXSAVE
+                (registers[2] & (1u << 28)) != 0 &&     // i.e. AVX
+                (_read_xcr0() & 0x6) == 0x6             // i.e. XMM and YMM states are saved by the OS
+            };
+
+            if (max_leaf >= 7) {
+                _cpuid(7, 0, registers);
+                features.avx2 = os_saves_avx && (registers[1] & (1u << 5)) != 0;
+                features.bmi2 = (registers[1] & (1u << 8)) != 0;
+            }
+
+            return features;
+        }
+
+#else
+        //---------------------------------------------------------------------------
+        static inline const CPUFeatures _evaluate_cpu_features() noexcept
+        {
+            return CPUFeatures();
+        }
+
+#endif
+
+
+        //===========================================================================
+        const CPUFeatures& get_cpu_features() noexcept
+        {
+            static const CPUFeatures cpu_features{ _evaluate_cpu_features() };
+            return cpu_features;
+        }
+
+    }
+
+}
\ No newline at end of file
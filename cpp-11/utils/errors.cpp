@@ -97,12 +97,16 @@ namespace bmpl
                 return "an invalid value for field 'next offset' has been detected in a BA file header.";
             case ErrorCode::INVALID_BITMAP_OFFSET:
                 return "the specified bitmap offset in file is invalid - gets a bigger value than the file size.";
+            case ErrorCode::INVALID_DESTINATION_BUFFER:
+                return "the destination buffer is missing or its rows are too short for the image width.";
             case ErrorCode::INVALID_DEVICE_RESOLUTION:
                 return "some device resolution is invalid (maybe negative, for instance).";
             case ErrorCode::INVALID_HEADER_SIZE:
                 return "the specified size for the info header is invalid.";
             case ErrorCode::INVALID_IMAGE_DIMENSIONS:
                 return "some dimension of image is set to zero.";
+            case ErrorCode::INVALID_IMAGE_REGION:
+                return "the image region is empty or it is not fully contained in the image.";
             case ErrorCode::INVALID_NEXT_OFFSET:
                 return "a specified offset to the next array header has been detected as invalid - too small value.";
             case ErrorCode::INVALID_NEXT_OFFSET_TOO_BIG:
@@ -137,6 +141,8 @@ namespace bmpl
                 return "some bitfield masks are overlapping.";
             case ErrorCode::RLE_INPUT_OPERATION_FAILED:
                 return "input operation on Run Length Encoded bitmap has failed.";
+            case ErrorCode::ROWS_STREAMING_CANCELLED:
+                return "streaming of image rows has been cancelled by the row callback.";
             case ErrorCode::TOO_BIG_BITS_PER_PIXEL_VALUE:
                 return "too big value for bits count per pixel.";
             case ErrorCode::UNABLE_TO_CREATE_BITMAP_LOADER:
@@ -72,9 +72,11 @@ namespace bmpl
             INPUT_OPERATION_FAILED,
             INVALID_BA_NEXT_OFFSET_VALUE,
             INVALID_BITMAP_OFFSET,
+            INVALID_DESTINATION_BUFFER,
             INVALID_DEVICE_RESOLUTION,
             INVALID_HEADER_SIZE,
             INVALID_IMAGE_DIMENSIONS,
+            INVALID_IMAGE_REGION,
             INVALID_NEXT_OFFSET,
             INVALID_NEXT_OFFSET_TOO_BIG,
             INVALID_OS2_BITMAP_RECORDING,
@@ -92,6 +94,7 @@ namespace bmpl
             NOT_YET_IMPLEMENTED_PNG_DECODING,
             OVERLAPPING_BITFIELD_MASKS,
             RLE_INPUT_OPERATION_FAILED,
+            ROWS_STREAMING_CANCELLED,
             TOO_BIG_BITS_PER_PIXEL_VALUE,
             UNABLE_TO_CREATE_BITMAP_LOADER,
         };
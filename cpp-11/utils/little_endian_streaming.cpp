@@ -36,123 +36,89 @@ namespace bmpl
     namespace utils
     {
         //---------------------------------------------------------------------------
-        const LEInStream::pos_type LEInStream::get_size() noexcept
-        {
-            pos_type current_stream_pos{ tellg() };
-            seekg(0, end);
-            pos_type stream_size{ tellg() };
-            seekg(current_stream_pos);
+        constexpr bool LEInStream::MEMORY_MAPPED;
+        constexpr std::size_t LEInStream::PREFETCH_BLOCK_SIZE;
+
 
-            return stream_size;
+        //---------------------------------------------------------------------------
+        LEInStream::LEInStream(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept
+            : MyErrClass()
+            , filepath()
+        {
+            try {
+                _open(std::make_shared<bmpl::utils::MemoryByteSource>(buffer_ptr, buffer_size));
+            }
+            catch (...) {
+                _open(nullptr);
+            }
         }
 
 
         //---------------------------------------------------------------------------
-        void LEInStream::_check_creation_ok() noexcept
+        LEInStream::LEInStream(const LEInStream& other) noexcept
+            : MyErrClass()
+            , filepath(other.filepath)
         {
-            if (good())
-                _clr_err();
-            else
-                MyErrClass::_set_err(bmpl::utils::ErrorCode::FILE_NOT_FOUND);
+            _open(other._source_ptr);
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::int8_t& value)
+        LEInStream& LEInStream::operator= (const LEInStream& other) noexcept
         {
-            char val;
-            if (read(&val, 1)) {
-                _clr_err();
-                value = std::int8_t(val);
+            if (this != &other) {
+                this->filepath = other.filepath;
+                _open(other._source_ptr);
             }
-            else
-                _set_err();
-
             return *this;
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::int16_t& value)
+        void LEInStream::close() noexcept
         {
-            _clr_err();
-
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 2))
-                    _set_err();
-            }
-            else {
-                char val[2];
-                if (read(val, 2))
-                    value = std::int16_t(
-                        std::uint16_t(std::uint8_t(*val)) + (std::uint16_t(std::uint8_t(val[1])) << 8)
-                    );
-                else
-                    _set_err();
-            }
-
-            return *this;
+            _source_ptr.reset();
+            _reset_block();
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::int32_t& value)
+        const std::uint8_t* LEInStream::get_contiguous_view(const std::size_t size) noexcept
         {
-            _clr_err();
-
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 4))
-                    _set_err();
-            }
-            else {
-                char val[4];
-                if (read(val, 4))
-                    value = std::int32_t(
-                        std::uint32_t(std::uint8_t(*val)) + (std::uint32_t(std::uint8_t(val[1])) << 8) +
-                        (std::uint32_t(std::uint8_t(val[2])) << 16) + (std::uint32_t(std::uint8_t(val[3])) << 24)
-                    );
-                else
-                    _set_err();
+            if (!good() || _source_ptr == nullptr)
+                return nullptr;
+
+            // notice: sizes are compared with the bytes left in block, so that huge sizes cannot wrap around
+            if (_position >= _block_offset && _position - _block_offset <= _block_size && size <= _block_size - (_position - _block_offset)) {
+                // the requested bytes are all available in the prefetched block
+                const std::uint8_t* view_ptr{ _block_ptr + (_position - _block_offset) };
+                _position += size;
+                return view_ptr;
             }
 
-            return *this;
+            const std::uint8_t* view_ptr{ _source_ptr->get_view(_position, size) };
+            if (view_ptr != nullptr)
+                _position += size;
+
+            return view_ptr;
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::int64_t& value)
+        const LEInStream::pos_type LEInStream::get_size() const noexcept
         {
-            _clr_err();
-
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 8))
-                    _set_err();
-            }
-            else {
-                char val[8];
-                if (read(val, 8))
-                    value = std::int64_t(
-                        std::uint64_t(std::uint8_t(*val)) + (std::uint64_t(std::uint8_t(val[1])) << 8) +
-                        (std::uint64_t(std::uint8_t(val[2])) << 16) + (std::uint64_t(std::uint8_t(val[3])) << 24) +
-                        (std::uint64_t(std::uint8_t(val[4])) << 32) + (std::uint64_t(std::uint8_t(val[5])) << 40) +
-                        (std::uint64_t(std::uint8_t(val[6])) << 48) + (std::uint64_t(std::uint8_t(val[7])) << 56)
-                    );
-                else
-                    _set_err();
-            }
-
-            return *this;
+            if (_source_ptr == nullptr)
+                return pos_type(-1);
+            else
+                return pos_type(_source_ptr->size());
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::uint8_t& value)
+        LEInStream& LEInStream::read(char* dst_ptr, const std::size_t count) noexcept
         {
-            char val;
-            if (read(&val, 1)) {
+            if (_read_bytes(reinterpret_cast<std::uint8_t*>(dst_ptr), count))
                 _clr_err();
-                value = std::uint8_t(val);
-            }
             else
                 _set_err();
 
@@ -161,82 +127,148 @@ namespace bmpl
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::uint16_t& value)
+        LEInStream& LEInStream::seekg(const pos_type position) noexcept
         {
-            _clr_err();
+            _eof = false;  // notice: same behavior as with std::istream::seekg()
 
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 2))
-                    _set_err();
-            }
-            else {
-                char val[2];
-                if (read(val, 2))
-                    value = std::uint16_t(std::uint8_t(*val)) + (std::uint16_t(std::uint8_t(val[1])) << 8);
-                else
-                    _set_err();
-            }
+            if (_fail || _source_ptr == nullptr || position < 0 || std::size_t(position) > _source_ptr->size())
+                _fail = true;
+            else
+                _position = std::size_t(position);
 
             return *this;
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::uint32_t& value)
+        const std::uint8_t* LEInStream::_fetch_block(const std::size_t count) noexcept
         {
-            _clr_err();
+            // slow path: the requested bytes are not all available in the prefetched block
+            if (_fail || _source_ptr == nullptr) {
+                _fail = true;
+                return nullptr;
+            }
+
+            const std::size_t source_size{ _source_ptr->size() };
 
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 4))
-                    _set_err();
+            if (_block_is_view || _position >= source_size) {
+                // the whole content of the source is already viewed, or the end of the source has been reached
+                _position = (_position < source_size && count < source_size - _position) ? _position + count : source_size;
+                _eof = _fail = true;  // notice: same behavior as with std::istream::read()
+                return nullptr;
             }
-            else {
-                char val[4];
-                if (read(val, 4))
-                    value = std::uint32_t(std::uint8_t(*val)) + (std::uint32_t(std::uint8_t(val[1])) << 8) +
-                    (std::uint32_t(std::uint8_t(val[2])) << 16) + (std::uint32_t(std::uint8_t(val[3])) << 24);
-                else
-                    _set_err();
+
+            // let's prefetch a whole block of bytes with one single read
+            try {
+                _block_buffer.resize(PREFETCH_BLOCK_SIZE);
+            }
+            catch (...) {
+                _reset_block();
+                _fail = true;
+                return nullptr;
             }
 
-            return *this;
+            _block_ptr = _block_buffer.data();
+            _block_offset = _position;
+            _block_size = _source_ptr->read_at(_position, _block_buffer.data(), PREFETCH_BLOCK_SIZE);
+
+            if (_block_size < count) {
+                _position += _block_size;
+                _eof = _fail = true;  // notice: same behavior as with std::istream::read()
+                return nullptr;
+            }
+
+            const std::uint8_t* bytes_ptr{ _block_ptr };
+            _position += count;
+            return bytes_ptr;
         }
 
 
         //---------------------------------------------------------------------------
-        LEInStream& LEInStream::operator>>(std::uint64_t& value)
+        void LEInStream::_open(const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr) noexcept
         {
-            _clr_err();
+            _source_ptr = source_ptr;
+            _position = 0;
+            _eof = false;
+            _reset_block();
 
-            if (PLATFORM_IS_LITTLE_ENDIAN) {
-                if (!read(reinterpret_cast<char*>(&value), 8))
-                    _set_err();
+            if (_source_ptr == nullptr) {
+                _fail = true;
+                MyErrClass::_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
+            }
+            else if (_source_ptr->failed()) {
+                _fail = true;
+                MyErrClass::_set_err(_source_ptr->get_error());
             }
             else {
-                char val[8];
-                if (read(val, 8)) {
-                    value = std::uint64_t(std::uint8_t(*val)) + (std::uint64_t(std::uint8_t(val[1])) << 8) +
-                        (std::uint64_t(std::uint8_t(val[2])) << 16) + (std::uint64_t(std::uint8_t(val[3])) << 24) +
-                        (std::uint64_t(std::uint8_t(val[4])) << 32) + (std::uint64_t(std::uint8_t(val[5])) << 40) +
-                        (std::uint64_t(std::uint8_t(val[6])) << 48) + (std::uint64_t(std::uint8_t(val[7])) << 56);
-                }
-                else {
-                    _set_err();
+                _fail = false;
+                _clr_err();
+
+                // sources that provide views are fully viewed, which then avoids any further copy of bytes
+                const std::size_t source_size{ _source_ptr->size() };
+                if (source_size > 0) {
+                    const std::uint8_t* view_ptr{ _source_ptr->get_view(0, source_size) };
+                    if (view_ptr != nullptr) {
+                        _block_ptr = view_ptr;
+                        _block_size = source_size;
+                        _block_is_view = true;
+                    }
                 }
             }
+        }
 
-            return *this;
+
+        //---------------------------------------------------------------------------
+        const bool LEInStream::_read_bytes(std::uint8_t* dst_ptr, const std::size_t count) noexcept
+        {
+            if (count == 0)
+                return !_fail;
+
+            if (count <= PREFETCH_BLOCK_SIZE || _block_is_view) {
+                const std::uint8_t* bytes_ptr{ _fetch(count) };
+                if (bytes_ptr == nullptr)
+                    return false;
+
+                std::memcpy(dst_ptr, bytes_ptr, count);
+                return true;
+            }
+
+            if (_fail || _source_ptr == nullptr) {
+                _fail = true;
+                return false;
+            }
+
+            // big reads do not go through the prefetched block
+            const std::size_t read_count{ _source_ptr->read_at(_position, dst_ptr, count) };
+            _position += read_count;
+
+            if (read_count < count) {
+                // notice: same behavior as with std::istream::read()
+                _eof = _fail = true;
+                return false;
+            }
+
+            return true;
+        }
+
+
+        //---------------------------------------------------------------------------
+        void LEInStream::_reset_block() noexcept
+        {
+            _block_buffer.clear();
+            _block_ptr = nullptr;
+            _block_offset = 0;
+            _block_size = 0;
+            _block_is_view = false;
         }
 
 
         //---------------------------------------------------------------------------
         void LEInStream::_set_err() noexcept
         {
-            if (fail())
+            if (_fail)
                 MyErrClass::_set_err(bmpl::utils::ErrorCode::INPUT_OPERATION_FAILED);
-            else if (bad())
-                MyErrClass::_set_err(bmpl::utils::ErrorCode::IRRECOVERABLE_STREAM_ERROR);
-            else if (eof())
+            else if (_eof)
                 MyErrClass::_set_err(bmpl::utils::ErrorCode::END_OF_FILE);
             else if (good())
                 _clr_err();
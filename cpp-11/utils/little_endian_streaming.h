@@ -33,9 +33,12 @@ SOFTWARE.
 
 
 #include <cstdint>
-#include <fstream>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "byte_sources.h"
 #include "errors.h"
 
 
@@ -44,67 +47,333 @@ namespace bmpl
     namespace utils
     {
         //===========================================================================
+        // notice: endianness is evaluated at compile time. Platforms that do not
+        // define __BYTE_ORDER__ (e.g. MSVC) are Windows ones, which all are little-endian.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#define BMPL_LITTLE_ENDIAN_PLATFORM  (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#elif defined(_WIN32)
+#define BMPL_LITTLE_ENDIAN_PLATFORM  1
+#else
+#define BMPL_LITTLE_ENDIAN_PLATFORM  0
+#endif
+
         static inline constexpr bool check_little_endianness() noexcept
         {
-            std::uint16_t one{ 1 };
-            return (*(std::uint8_t*)(&one) == 1);
+            return BMPL_LITTLE_ENDIAN_PLATFORM != 0;
         }
 
 
-        static const bool PLATFORM_IS_LITTLE_ENDIAN{ check_little_endianness() };
+        static constexpr bool PLATFORM_IS_LITTLE_ENDIAN{ check_little_endianness() };
 
 
         //===========================================================================
-        class LEInStream : public std::ifstream, public bmpl::utils::ErrorStatus
+#if BMPL_LITTLE_ENDIAN_PLATFORM
+        static inline const std::uint16_t get_le_uint16(const std::uint8_t* bytes_ptr) noexcept
+        {
+            std::uint16_t value;
+            std::memcpy(&value, bytes_ptr, sizeof(value));
+            return value;
+        }
+
+
+        static inline const std::uint32_t get_le_uint32(const std::uint8_t* bytes_ptr) noexcept
+        {
+            std::uint32_t value;
+            std::memcpy(&value, bytes_ptr, sizeof(value));
+            return value;
+        }
+
+
+        static inline const std::uint64_t get_le_uint64(const std::uint8_t* bytes_ptr) noexcept
+        {
+            std::uint64_t value;
+            std::memcpy(&value, bytes_ptr, sizeof(value));
+            return value;
+        }
+
+#else
+        static inline const std::uint16_t get_le_uint16(const std::uint8_t* bytes_ptr) noexcept
+        {
+            return std::uint16_t(bytes_ptr[0]) | (std::uint16_t(bytes_ptr[1]) << 8);
+        }
+
+
+        static inline const std::uint32_t get_le_uint32(const std::uint8_t* bytes_ptr) noexcept
+        {
+            return std::uint32_t(bytes_ptr[0]) | (std::uint32_t(bytes_ptr[1]) << 8) |
+                (std::uint32_t(bytes_ptr[2]) << 16) | (std::uint32_t(bytes_ptr[3]) << 24);
+        }
+
+
+        static inline const std::uint64_t get_le_uint64(const std::uint8_t* bytes_ptr) noexcept
+        {
+            return std::uint64_t(get_le_uint32(bytes_ptr)) | (std::uint64_t(get_le_uint32(bytes_ptr + 4)) << 32);
+        }
+
+#endif
+
+
+        //===========================================================================
+        class LEInStream : public bmpl::utils::ErrorStatus
         {
         public:
 
-            using MyBaseClass = std::ifstream;
             using MyErrClass = bmpl::utils::ErrorStatus;
 
-            using pos_type = MyBaseClass::pos_type;
+            using pos_type = std::int64_t;
+
+            static constexpr bool MEMORY_MAPPED{ true };
+
+            static constexpr std::size_t PREFETCH_BLOCK_SIZE{ 4096 };  // notice: big enough to contain all headers and the color palette of most BMP files
 
             std::string filepath{};
 
             LEInStream() noexcept = default;
 
 
-            inline LEInStream(const char* filepath) noexcept
-                : MyBaseClass(filepath, std::ios::binary)
-                , MyErrClass()
+            inline LEInStream(const char* filepath, const bool memory_mapped = !MEMORY_MAPPED) noexcept
+                : MyErrClass()
                 , filepath(filepath)
             {
-                _check_creation_ok();
+                _open(bmpl::utils::create_file_byte_source(this->filepath, memory_mapped));
             }
 
 
-            inline LEInStream(const std::string& filepath) noexcept
-                : MyBaseClass(filepath, std::ios::binary)
-                , MyErrClass()
+            inline LEInStream(const std::string& filepath, const bool memory_mapped = !MEMORY_MAPPED) noexcept
+                : MyErrClass()
                 , filepath(filepath)
             {
-                _check_creation_ok();
+                _open(bmpl::utils::create_file_byte_source(this->filepath, memory_mapped));
+            }
+
+
+            LEInStream(const std::uint8_t* buffer_ptr, const std::size_t buffer_size) noexcept;  // notice: the buffer content is not copied and must outlive this stream
+
+
+            inline LEInStream(const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr) noexcept
+                : MyErrClass()
+                , filepath()
+            {
+                _open(source_ptr);
             }
 
 
+            LEInStream(const LEInStream& other) noexcept;  // notice: the new stream shares the same source but gets its own reading position
+
+
             virtual ~LEInStream() noexcept = default;
 
 
-            const pos_type get_size() noexcept;  // notice: type 'pos_type' is inherited from base class std::ifstream
+            LEInStream& operator= (const LEInStream& other) noexcept;  // notice: same as with the copy constructor
+
+
+            inline void clear() noexcept
+            {
+                _eof = _fail = false;
+            }
+
+
+            void close() noexcept;  // notice: releases this stream reference to its source, which gets closed once no more stream shares it
+
+
+            [[nodiscard]]
+            inline const bool eof() const noexcept
+            {
+                return _eof;
+            }
+
+
+            [[nodiscard]]
+            inline const bool fail() const noexcept
+            {
+                return _fail;
+            }
+
+
+            [[nodiscard]]
+            inline const bool good() const noexcept
+            {
+                return !_eof && !_fail;
+            }
+
+
+            [[nodiscard]]
+            inline const bool is_open() const noexcept
+            {
+                return _source_ptr != nullptr;
+            }
 
 
-            LEInStream& operator>>(std::int8_t& value);
-            LEInStream& operator>>(std::int16_t& value);
-            LEInStream& operator>>(std::int32_t& value);
-            LEInStream& operator>>(std::int64_t& value);
-            LEInStream& operator>>(std::uint8_t& value);
-            LEInStream& operator>>(std::uint16_t& value);
-            LEInStream& operator>>(std::uint32_t& value);
-            LEInStream& operator>>(std::uint64_t& value);
-            
+            [[nodiscard]]
+            const std::uint8_t* get_contiguous_view(const std::size_t size) noexcept;  // notice: returns nullptr if no view can be provided on next size bytes; a view into the prefetched block is valid until next read on this stream
+
+
+            [[nodiscard]]
+            const pos_type get_size() const noexcept;
+
+
+            [[nodiscard]]
+            inline const std::shared_ptr<bmpl::utils::ByteSource>& get_source_ptr() const noexcept
+            {
+                return _source_ptr;
+            }
+
+
+            LEInStream& read(char* dst_ptr, const std::size_t count) noexcept;
+
+
+            LEInStream& seekg(const pos_type position) noexcept;
+
+
+            inline void will_need(const std::size_t size) noexcept
+            {
+                // notice: hints the source that the next size bytes will be read soon
+                if (good() && _source_ptr != nullptr)
+                    _source_ptr->will_need(_position, size);
+            }
+
+
+            [[nodiscard]]
+            inline const pos_type tellg() const noexcept
+            {
+                return _fail ? pos_type(-1) : pos_type(_position);
+            }
+
+
+            inline LEInStream& operator>>(std::int8_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(1) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = std::int8_t(*bytes_ptr);
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::int16_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(2) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = std::int16_t(get_le_uint16(bytes_ptr));
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::int32_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(4) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = std::int32_t(get_le_uint32(bytes_ptr));
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::int64_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(8) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = std::int64_t(get_le_uint64(bytes_ptr));
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::uint8_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(1) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = *bytes_ptr;
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::uint16_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(2) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = get_le_uint16(bytes_ptr);
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::uint32_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(4) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = get_le_uint32(bytes_ptr);
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
+
+            inline LEInStream& operator>>(std::uint64_t& value) noexcept
+            {
+                const std::uint8_t* bytes_ptr{ _fetch(8) };
+                if (bytes_ptr != nullptr) {
+                    _clr_err();
+                    value = get_le_uint64(bytes_ptr);
+                }
+                else
+                    _set_err();
+                return *this;
+            }
+
 
         private:
-            void _check_creation_ok() noexcept;
+            std::shared_ptr<bmpl::utils::ByteSource> _source_ptr{};
+            std::size_t _position{ 0 };
+            bool _eof{ false };
+            bool _fail{ false };
+
+            // the prefetched block of bytes: either a view on the whole source content or a copy of a part of it
+            std::vector<std::uint8_t> _block_buffer{};
+            const std::uint8_t* _block_ptr{ nullptr };
+            std::size_t _block_offset{ 0 };
+            std::size_t _block_size{ 0 };
+            bool _block_is_view{ false };
+
+
+            inline const std::uint8_t* _fetch(const std::size_t count) noexcept
+            {
+                // fast path: the requested bytes are already available in the prefetched block
+                if (!_fail && _position >= _block_offset && _position - _block_offset <= _block_size && count <= _block_size - (_position - _block_offset)) {
+                    const std::uint8_t* bytes_ptr{ _block_ptr + (_position - _block_offset) };
+                    _position += count;
+                    return bytes_ptr;
+                }
+                else
+                    return _fetch_block(count);
+            }
+
+            const std::uint8_t* _fetch_block(const std::size_t count) noexcept;
+            void _open(const std::shared_ptr<bmpl::utils::ByteSource>& source_ptr) noexcept;
+            const bool _read_bytes(std::uint8_t* dst_ptr, const std::size_t count) noexcept;
+            void _reset_block() noexcept;
             void _set_err() noexcept;
 
         };
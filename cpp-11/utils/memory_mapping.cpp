@@ -0,0 +1,131 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "memory_mapping.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //---------------------------------------------------------------------------
+        const bool MemoryMapping::map(const std::string& filepath) noexcept
+        {
+            unmap();
+
+#if defined(_WIN32)
+            HANDLE file_handle{ CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+            if (file_handle == INVALID_HANDLE_VALUE)
+                return _set_err(ErrorCode::FILE_NOT_FOUND);
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0) {
+                CloseHandle(file_handle);
+                return _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            }
+
+            HANDLE mapping_handle{ CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+            if (mapping_handle == nullptr) {
+                CloseHandle(file_handle);
+                return _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            }
+
+            void* view_ptr{ MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0) };
+            if (view_ptr == nullptr) {
+                CloseHandle(mapping_handle);
+                CloseHandle(file_handle);
+                return _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            }
+
+            _file_handle = file_handle;
+            _mapping_handle = mapping_handle;
+            _data_ptr = static_cast<const std::uint8_t*>(view_ptr);
+            _size = std::size_t(file_size.QuadPart);
+
+#else
+            const int fd{ ::open(filepath.c_str(), O_RDONLY) };
+            if (fd < 0)
+                return _set_err(ErrorCode::FILE_NOT_FOUND);
+
+            struct stat file_stat;
+            if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) || file_stat.st_size == 0) {
+                ::close(fd);
+                return _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+            }
+
+            void* view_ptr{ ::mmap(nullptr, std::size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0) };
+            ::close(fd);  // notice: the mapping keeps its own reference on the file
+
+            if (view_ptr == MAP_FAILED)
+                return _set_err(ErrorCode::INPUT_OPERATION_FAILED);
+
+#if defined(MADV_SEQUENTIAL)
+            ::madvise(view_ptr, std::size_t(file_stat.st_size), MADV_SEQUENTIAL);
+#endif
+
+            _data_ptr = static_cast<const std::uint8_t*>(view_ptr);
+            _size = std::size_t(file_stat.st_size);
+#endif
+
+            return _clr_err();
+        }
+
+
+        //---------------------------------------------------------------------------
+        void MemoryMapping::unmap() noexcept
+        {
+            if (_data_ptr != nullptr) {
+#if defined(_WIN32)
+                UnmapViewOfFile(_data_ptr);
+                CloseHandle(_mapping_handle);
+                CloseHandle(_file_handle);
+                _mapping_handle = _file_handle = nullptr;
+#else
+                ::munmap(const_cast<std::uint8_t*>(_data_ptr), _size);
+#endif
+                _data_ptr = nullptr;
+                _size = 0;
+            }
+
+            _set_err(ErrorCode::NOT_INITIALIZED);
+        }
+
+    }
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+
+// Let's exclude rarely-used stuff from Windows headers
+// (gets no effect on non Windows platforms)
+#define WIN32_LEAN_AND_MEAN
+
+
+#include <cstdint>
+#include <string>
+
+#include "errors.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //===========================================================================
+        class MemoryMapping : public bmpl::utils::ErrorStatus
+        {
+        public:
+
+            using MyErrClass = bmpl::utils::ErrorStatus;
+
+
+            MemoryMapping() noexcept = default;
+
+            inline MemoryMapping(const std::string& filepath) noexcept
+                : MyErrClass()
+            {
+                map(filepath);
+            }
+
+            MemoryMapping(const MemoryMapping&) noexcept = delete;
+            MemoryMapping(MemoryMapping&&) noexcept = delete;
+
+            virtual inline ~MemoryMapping() noexcept
+            {
+                unmap();
+            }
+
+            MemoryMapping& operator= (const MemoryMapping&) noexcept = delete;
+            MemoryMapping& operator= (MemoryMapping&&) noexcept = delete;
+
+
+            [[nodiscard]]
+            inline const std::uint8_t* data() const noexcept
+            {
+                return this->_data_ptr;
+            }
+
+            [[nodiscard]]
+            inline const bool is_mapped() const noexcept
+            {
+                return this->_data_ptr != nullptr;
+            }
+
+            const bool map(const std::string& filepath) noexcept;
+
+            [[nodiscard]]
+            inline const std::size_t size() const noexcept
+            {
+                return this->_size;
+            }
+
+            void unmap() noexcept;
+
+
+        private:
+            const std::uint8_t* _data_ptr{ nullptr };
+            std::size_t _size{ 0 };
+
+#if defined(_WIN32)
+            void* _file_handle{ nullptr };
+            void* _mapping_handle{ nullptr };
+#endif
+
+        };
+
+    }
+}
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "memory_resources.h"
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //===========================================================================
+        // Local declarations
+        //---------------------------------------------------------------------------
+        static inline const std::size_t _align_up(const std::size_t value, const std::size_t alignment) noexcept
+        {
+            // notice: alignment is always a power of 2
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+
+        //---------------------------------------------------------------------------
+        class _NewDeleteResource : public MemoryResource
+        {
+        protected:
+            virtual inline void* _do_allocate(const std::size_t bytes_count, const std::size_t alignment) override
+            {
+                // notice: global operator new aligns memory for any fundamental type, which is fine for pixels and bytes
+                if (alignment <= alignof(std::max_align_t))
+                    return ::operator new(bytes_count);
+
+                // over-aligned memory is carved out of a bigger allocation, the address of which is stored just before the aligned memory
+                if (bytes_count > std::numeric_limits<std::size_t>::max() - alignment)
+                    throw std::bad_alloc();
+                std::uint8_t* over_ptr{ static_cast<std::uint8_t*>(::operator new(bytes_count + alignment)) };
+                std::uint8_t* aligned_ptr{ reinterpret_cast<std::uint8_t*>(_align_up(std::size_t(over_ptr) + 1, alignment)) };
+                reinterpret_cast<void**>(aligned_ptr)[-1] = over_ptr;
+                return aligned_ptr;
+            }
+
+            virtual inline void _do_deallocate(void* ptr, const std::size_t /*bytes_count*/, const std::size_t alignment) noexcept override
+            {
+                if (alignment <= alignof(std::max_align_t))
+                    ::operator delete(ptr);
+                else
+                    ::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+            }
+        };
+
+        static _NewDeleteResource _new_delete_resource;
+        static std::atomic<MemoryResource*> _default_resource_ptr{ &_new_delete_resource };
+
+        static constexpr std::size_t _SYSTEM_PAGE_SIZE{ 4096 };  // notice: the smallest size of memory pages on supported platforms
+
+
+        //---------------------------------------------------------------------------
+        static inline void _populate_pages(void* ptr, const std::size_t size) noexcept
+        {
+            // notice: one write per page maps the whole memory at once, and one single fault per huge page takes place
+            volatile std::uint8_t* bytes_ptr{ static_cast<volatile std::uint8_t*>(ptr) };
+            for (std::size_t offset = 0; offset < size; offset += _SYSTEM_PAGE_SIZE)
+                bytes_ptr[offset] = 0;
+        }
+
+
+        //===========================================================================
+        // Local implementations  -  default memory resources
+        //---------------------------------------------------------------------------
+        MemoryResource* get_new_delete_resource() noexcept
+        {
+            return &_new_delete_resource;
+        }
+
+
+        //---------------------------------------------------------------------------
+        MemoryResource* get_default_memory_resource() noexcept
+        {
+            return _default_resource_ptr.load();
+        }
+
+
+        //---------------------------------------------------------------------------
+        MemoryResource* set_default_memory_resource(MemoryResource* resource_ptr) noexcept
+        {
+            return _default_resource_ptr.exchange((resource_ptr != nullptr) ? resource_ptr : &_new_delete_resource);
+        }
+
+
+        //===========================================================================
+        // Local implementations  -  MonotonicArena
+        //---------------------------------------------------------------------------
+        MonotonicArena::MonotonicArena(const std::size_t chunk_size, MemoryResource* upstream_ptr) noexcept
+            : MemoryResource()
+            , _upstream_ptr((upstream_ptr != nullptr) ? upstream_ptr : get_new_delete_resource())
+            , _chunk_size((chunk_size > 0) ? chunk_size : DEFAULT_CHUNK_SIZE)
+        {}
+
+
+        //---------------------------------------------------------------------------
+        void MonotonicArena::release() noexcept
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            for (const _Chunk& chunk : _chunks)
+                _upstream_ptr->deallocate(chunk.data_ptr, chunk.size);
+            _chunks.clear();
+            _current_chunk = _current_offset = 0;
+        }
+
+
+        //---------------------------------------------------------------------------
+        void MonotonicArena::reset() noexcept
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // notice: chunks are kept, so that their memory pages are already mapped when next used
+            _current_chunk = _current_offset = 0;
+        }
+
+
+        //---------------------------------------------------------------------------
+        void* MonotonicArena::_do_allocate(const std::size_t bytes_count, const std::size_t alignment)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            // evaluates first the space that is left in the current chunk and in the already allocated next ones
+            for (; _current_chunk < _chunks.size(); ++_current_chunk, _current_offset = 0) {
+                const _Chunk& chunk{ _chunks[_current_chunk] };
+                const std::size_t base{ std::size_t(chunk.data_ptr) };
+                const std::size_t offset{ _align_up(base + _current_offset, alignment) - base };
+                if (offset <= chunk.size && bytes_count <= chunk.size - offset) {
+                    _current_offset = offset + bytes_count;
+                    return chunk.data_ptr + offset;
+                }
+            }
+
+            // then gets a new chunk from upstream, big enough for the requested size
+            if (bytes_count > std::numeric_limits<std::size_t>::max() - alignment)
+                throw std::bad_alloc();
+            const std::size_t chunk_size{ (std::max)(_chunk_size, bytes_count + alignment) };
+            _chunks.reserve(_chunks.size() + 1);  // notice: may throw, before the chunk gets allocated
+            std::uint8_t* data_ptr{ static_cast<std::uint8_t*>(_upstream_ptr->allocate(chunk_size)) };
+            _chunks.push_back(_Chunk{ data_ptr, chunk_size });
+
+            _current_chunk = _chunks.size() - 1;
+            const std::size_t offset{ _align_up(std::size_t(data_ptr), alignment) - std::size_t(data_ptr) };
+            _current_offset = offset + bytes_count;
+            return data_ptr + offset;
+        }
+
+
+        //===========================================================================
+        // Local implementations  -  HugePagesResource
+        //---------------------------------------------------------------------------
+        HugePagesResource::HugePagesResource(const std::size_t min_huge_size, const bool populate, MemoryResource* upstream_ptr) noexcept
+            : MemoryResource()
+            , _upstream_ptr((upstream_ptr != nullptr) ? upstream_ptr : get_new_delete_resource())
+            , _min_huge_size(min_huge_size)
+            , _populate(populate)
+        {}
+
+
+        //---------------------------------------------------------------------------
+        void* HugePagesResource::_do_allocate(const std::size_t bytes_count, const std::size_t alignment)
+        {
+            if (bytes_count < _min_huge_size)
+                return _upstream_ptr->allocate(bytes_count, alignment);
+
+            const std::size_t mapped_size{ _mapped_size(bytes_count) };
+            void* ptr{ nullptr };
+
+#if defined(_WIN32)
+            // large pages need privilege SeLockMemoryPrivilege, regular pages are mapped otherwise
+            const SIZE_T large_page_size{ GetLargePageMinimum() };
+            if (large_page_size != 0)
+                ptr = VirtualAlloc(nullptr, _align_up(mapped_size, large_page_size), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (ptr == nullptr)
+                ptr = VirtualAlloc(nullptr, mapped_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            if (ptr == nullptr)
+                throw std::bad_alloc();
+
+#else
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_2MB)
+            // explicitly reserved huge pages are tried first
+            ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+            if (ptr == MAP_FAILED)
+                ptr = nullptr;
+#endif
+            if (ptr == nullptr) {
+                // otherwise, transparent huge pages need memory that is aligned on huge pages boundaries
+                const std::size_t over_size{ mapped_size + HUGE_PAGE_SIZE };
+                void* over_ptr{ ::mmap(nullptr, over_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+                if (over_ptr == MAP_FAILED)
+                    throw std::bad_alloc();
+
+                std::uint8_t* over_begin{ static_cast<std::uint8_t*>(over_ptr) };
+                std::uint8_t* aligned_ptr{ reinterpret_cast<std::uint8_t*>(_align_up(std::size_t(over_begin), HUGE_PAGE_SIZE)) };
+                const std::size_t head_size{ std::size_t(aligned_ptr - over_begin) };
+                if (head_size > 0)
+                    ::munmap(over_begin, head_size);
+                if (over_size - head_size > mapped_size)
+                    ::munmap(aligned_ptr + mapped_size, over_size - head_size - mapped_size);
+
+#if defined(MADV_HUGEPAGE)
+                ::madvise(aligned_ptr, mapped_size, MADV_HUGEPAGE);
+#endif
+                ptr = aligned_ptr;
+            }
+#endif
+
+            if (_populate)
+                _populate_pages(ptr, mapped_size);
+
+            return ptr;
+        }
+
+
+        //---------------------------------------------------------------------------
+        void HugePagesResource::_do_deallocate(void* ptr, const std::size_t bytes_count, const std::size_t alignment) noexcept
+        {
+            if (bytes_count < _min_huge_size)
+                _upstream_ptr->deallocate(ptr, bytes_count, alignment);
+            else
+#if defined(_WIN32)
+                VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+                ::munmap(ptr, _mapped_size(bytes_count));
+#endif
+        }
+
+    }
+}
@@ -0,0 +1,317 @@
+#pragma once
+
+/*
+MIT License
+
+Copyright (c) 2024-2026 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/*
+* NOTICE: code here is implemented according to the c++14 standard.  It should
+* function  as  well  when  compiled  with  standard  c++11  since  no   c++14
+* specificities have been used there, but it has not been tested as such.
+*/
+
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace bmpl
+{
+    namespace utils
+    {
+        //===========================================================================
+        // Memory resources - the source of the memory of images contents and of decoding buffers.
+        // This is a c++14 counterpart of c++17 std::pmr::memory_resource: allocations
+        // throw std::bad_alloc on failure, as containers expect it.
+        class MemoryResource
+        {
+        public:
+            MemoryResource() noexcept = default;
+            MemoryResource(const MemoryResource&) noexcept = delete;
+            MemoryResource(MemoryResource&&) noexcept = delete;
+
+            virtual ~MemoryResource() noexcept = default;
+
+            MemoryResource& operator= (const MemoryResource&) noexcept = delete;
+            MemoryResource& operator= (MemoryResource&&) noexcept = delete;
+
+
+            [[nodiscard]]
+            inline void* allocate(const std::size_t bytes_count, const std::size_t alignment = alignof(std::max_align_t))
+            {
+                return _do_allocate(bytes_count, alignment);
+            }
+
+            inline void deallocate(void* ptr, const std::size_t bytes_count, const std::size_t alignment = alignof(std::max_align_t)) noexcept
+            {
+                if (ptr != nullptr)
+                    _do_deallocate(ptr, bytes_count, alignment);
+            }
+
+
+        protected:
+            virtual void* _do_allocate(const std::size_t bytes_count, const std::size_t alignment) = 0;
+
+            virtual void _do_deallocate(void* ptr, const std::size_t bytes_count, const std::size_t alignment) noexcept = 0;
+
+        };
+
+
+        //===========================================================================
+        // The memory resource that is used by default, i.e. global operators new and delete.
+        [[nodiscard]]
+        MemoryResource* get_new_delete_resource() noexcept;
+
+        // The memory resource that images and loaders get when none is specified.
+        [[nodiscard]]
+        MemoryResource* get_default_memory_resource() noexcept;
+
+        // Sets the memory resource that images and loaders get when none is specified and
+        // returns the former one. Passing nullptr resets it to the new-delete resource.
+        // notice: the resource must stay alive as long as images and loaders that use it.
+        MemoryResource* set_default_memory_resource(MemoryResource* resource_ptr) noexcept;
+
+
+        //===========================================================================
+        // A monotonic arena - allocations are carved out of big chunks of memory and are never
+        // freed one by one, which fits batch jobs: all the memory of a batch gets recycled at once.
+        // notice: this arena is thread safe, so that it may be used by concurrent loadings of images.
+        class MonotonicArena : public MemoryResource
+        {
+        public:
+            static constexpr std::size_t DEFAULT_CHUNK_SIZE{ 64 * 1024 * 1024 };
+
+
+            explicit MonotonicArena(const std::size_t chunk_size = DEFAULT_CHUNK_SIZE, MemoryResource* upstream_ptr = nullptr) noexcept;
+
+            virtual inline ~MonotonicArena() noexcept
+            {
+                release();
+            }
+
+
+            // Gives back all the chunks of this arena to its upstream resource.
+            void release() noexcept;
+
+            // Recycles all the chunks of this arena for next allocations, with no call to its upstream resource.
+            // notice: nothing allocated with this arena before the reset may be used afterwards.
+            void reset() noexcept;
+
+
+        protected:
+            virtual void* _do_allocate(const std::size_t bytes_count, const std::size_t alignment) override;
+
+            virtual inline void _do_deallocate(void* /*ptr*/, const std::size_t /*bytes_count*/, const std::size_t /*alignment*/) noexcept override
+            {
+                // notice: memory gets recycled on reset() or release() only
+            }
+
+
+        private:
+            struct _Chunk
+            {
+                std::uint8_t* data_ptr;
+                std::size_t size;
+            };
+
+            std::vector<_Chunk> _chunks{};
+            std::mutex _mutex{};
+            MemoryResource* _upstream_ptr{ nullptr };
+            std::size_t _chunk_size{ DEFAULT_CHUNK_SIZE };
+            std::size_t _current_chunk{ 0 };
+            std::size_t _current_offset{ 0 };
+
+        };
+
+
+        //===========================================================================
+        // A memory resource for big images - big allocations are directly mapped from the system
+        // and get backed by huge pages when available, which drastically lowers the count of page
+        // faults when fresh memory is first written. Smaller allocations get forwarded to the
+        // upstream resource.
+        class HugePagesResource : public MemoryResource
+        {
+        public:
+            static constexpr std::size_t HUGE_PAGE_SIZE{ 2 * 1024 * 1024 };  // notice: the most common size of huge pages on x86-64 and ARM64 platforms
+
+
+            explicit HugePagesResource(
+                const std::size_t min_huge_size = HUGE_PAGE_SIZE,
+                const bool populate = false,
+                MemoryResource* upstream_ptr = nullptr
+            ) noexcept;
+
+            virtual ~HugePagesResource() noexcept = default;
+
+
+        protected:
+            virtual void* _do_allocate(const std::size_t bytes_count, const std::size_t alignment) override;
+
+            virtual void _do_deallocate(void* ptr, const std::size_t bytes_count, const std::size_t alignment) noexcept override;
+
+
+        private:
+            MemoryResource* _upstream_ptr{ nullptr };
+            std::size_t _min_huge_size{ HUGE_PAGE_SIZE };
+            bool _populate{ false };  // notice: when true, pages get mapped at allocation time rather than on first writes
+
+            static inline const std::size_t _mapped_size(const std::size_t bytes_count) noexcept
+            {
+                return (bytes_count + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+            }
+
+        };
+
+
+        //===========================================================================
+        // The allocator of containers that get their memory from a memory resource.
+        template<typename T>
+        class ResourceAllocator
+        {
+        public:
+            using value_type = T;
+
+            using propagate_on_container_copy_assignment = std::true_type;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap = std::true_type;
+
+
+            inline ResourceAllocator() noexcept
+                : _resource_ptr(get_default_memory_resource())
+            {}
+
+            inline ResourceAllocator(MemoryResource* resource_ptr) noexcept
+                : _resource_ptr((resource_ptr != nullptr) ? resource_ptr : get_default_memory_resource())
+            {}
+
+            template<typename U>
+            inline ResourceAllocator(const ResourceAllocator<U>& other) noexcept
+                : _resource_ptr(other.resource())
+            {}
+
+
+            [[nodiscard]]
+            inline T* allocate(const std::size_t count)
+            {
+                if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                    throw std::bad_alloc();
+                return static_cast<T*>(_resource_ptr->allocate(count * sizeof(T), alignof(T)));
+            }
+
+            inline void deallocate(T* ptr, const std::size_t count) noexcept
+            {
+                _resource_ptr->deallocate(ptr, count * sizeof(T), alignof(T));
+            }
+
+            [[nodiscard]]
+            inline MemoryResource* resource() const noexcept
+            {
+                return _resource_ptr;
+            }
+
+
+        private:
+            MemoryResource* _resource_ptr;
+
+        };
+
+
+        //---------------------------------------------------------------------------
+        template<typename T, typename U>
+        inline const bool operator== (const ResourceAllocator<T>& lhs, const ResourceAllocator<U>& rhs) noexcept
+        {
+            return lhs.resource() == rhs.resource();
+        }
+
+        template<typename T, typename U>
+        inline const bool operator!= (const ResourceAllocator<T>& lhs, const ResourceAllocator<U>& rhs) noexcept
+        {
+            return lhs.resource() != rhs.resource();
+        }
+
+
+        //===========================================================================
+        // The allocator of containers which elements all get overwritten once allocated. Default
+        // constructions of trivially copyable elements are skipped, so that resizing containers
+        // does not write their whole memory - nor does it map all its pages at once.
+        template<typename T>
+        class NoInitResourceAllocator : public ResourceAllocator<T>
+        {
+        public:
+            template<typename U>
+            struct rebind
+            {
+                using other = NoInitResourceAllocator<U>;
+            };
+
+
+            using ResourceAllocator<T>::ResourceAllocator;
+
+            inline NoInitResourceAllocator() noexcept = default;
+
+
+            template<typename U>
+            inline void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value)
+            {
+                _construct(ptr, std::is_trivially_copyable<U>());
+            }
+
+            template<typename U, typename... ArgsT>
+            inline void construct(U* ptr, ArgsT&&... args)
+            {
+                ::new(static_cast<void*>(ptr)) U(std::forward<ArgsT>(args)...);
+            }
+
+
+        private:
+            template<typename U>
+            static inline void _construct(U* /*ptr*/, std::true_type) noexcept
+            {}
+
+            template<typename U>
+            static inline void _construct(U* ptr, std::false_type) noexcept(std::is_nothrow_default_constructible<U>::value)
+            {
+                ::new(static_cast<void*>(ptr)) U();
+            }
+
+        };
+
+
+        //===========================================================================
+        // Vectors with memory got from memory resources.
+        template<typename T>
+        using ResourceVector = std::vector<T, ResourceAllocator<T>>;
+
+        // Vectors with memory got from memory resources, which elements are not initialized when resized.
+        template<typename T>
+        using NoInitResourceVector = std::vector<T, NoInitResourceAllocator<T>>;
+
+    }
+}
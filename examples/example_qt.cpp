@@ -65,8 +65,26 @@ QImage load_RGB_image(
     const bool apply_gamma_correction,
     const bmpl::clr::ESkippedPixelsMode skipped_mode) noexcept
 {
-    // let's load the related image
-    bmpl::RGBBMPImage bmp_image(image_filepath, apply_gamma_correction, skipped_mode);
+    // let's first get the dimensions of the related image, with no decoding of its pixels
+    const bmpl::frmt::BMPProbeInfo probe_info{ bmpl::frmt::probe(image_filepath) };
+    if (probe_info.failed()) {
+        std::cout << bmpl::utils::error_msg(image_filepath, probe_info.error_code) << std::endl;
+        return QImage();
+    }
+    QImage ret_qimage(probe_info.images[0].width, probe_info.images[0].height, QImage::Format_RGB888);
+    if (ret_qimage.isNull())
+        return QImage();
+
+    // then let's decode the image straight into the bits of the final image
+    // notice: rows of Qt images are 32-bits aligned, so their stride may be greater than their width times 3 bytes
+    bmpl::RGBBMPImage bmp_image;
+    bmp_image.load_into(
+        reinterpret_cast<bmpl::RGBBMPImage::pixel_type*>(ret_qimage.bits()),
+        ret_qimage.bytesPerLine(),
+        image_filepath,
+        apply_gamma_correction,
+        skipped_mode
+    );
     // did loading succeed?
     if (!bmp_image) {  // notice: "if (bmp_image.failed())" would fit also
         // whatever the error, just display it
@@ -78,13 +96,10 @@ QImage load_RGB_image(
         // loading was fine
         // let's display maybe warnings
         if (bmp_image.has_warnings()) {
-            for (auto& msg : bmp_loader.get_warnings_msg())
+            for (auto& msg : bmp_image.get_warnings_msg())
                 std::cout << msg << std::endl;
         }
         // and return the final image
-        QImage ret_qimage(bmp_image.width, bmp_image.height, QImage::Format_RGB888);
-        if (!ret_qimage.isNull())
-            std::memcpy(ret_qimage.bits(), bmp_image.get_content_ptr(), bmp_image.get_size() * 3);
         return ret_qimage;
     }
 }
@@ -129,8 +144,26 @@ QImage load_BGR_image(
     const bool apply_gamma_correction,
     const bmpl::clr::ESkippedPixelsMode skipped_mode) noexcept
 {
-    // let's load the related image then
-    bmpl::BGRBMPImage bmp_image(image_filepath, apply_gamma_correction, skipped_mode);
+    // let's first get the dimensions of the related image, with no decoding of its pixels
+    const bmpl::frmt::BMPProbeInfo probe_info{ bmpl::frmt::probe(image_filepath) };
+    if (probe_info.failed()) {
+        std::cout << bmpl::utils::error_msg(image_filepath, probe_info.error_code) << std::endl;
+        return QImage();
+    }
+    QImage ret_qimage(probe_info.images[0].width, probe_info.images[0].height, QImage::Format_BGR888);
+    if (ret_qimage.isNull())
+        return QImage();
+
+    // then let's decode the image straight into the bits of the final image
+    // notice: rows of Qt images are 32-bits aligned, so their stride may be greater than their width times 3 bytes
+    bmpl::BGRBMPImage bmp_image;
+    bmp_image.load_into(
+        reinterpret_cast<bmpl::BGRBMPImage::pixel_type*>(ret_qimage.bits()),
+        ret_qimage.bytesPerLine(),
+        image_filepath,
+        apply_gamma_correction,
+        skipped_mode
+    );
     // did loading succeed?
     if (!bmp_image) {  // notice: "if (bmp_image.failed())" would fit also
         // whatever the error, just display it
@@ -146,9 +179,6 @@ QImage load_BGR_image(
                 std::cout << msg << std::endl;
         }
         // and return the final image
-        QImage ret_qimage(bmp_image.width, bmp_image.height, QImage::Format_BGR888);
-        if (!ret_qimage.isNull())
-            std::memcpy(ret_qimage.bits(), bmp_image.get_content_ptr(), bmp_image.get_size() * 3);
         return ret_qimage;
     }
 }